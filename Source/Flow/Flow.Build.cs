@@ -10,11 +10,13 @@ public class Flow : ModuleRules
 
 		PublicDependencyModuleNames.AddRange(new[]
 		{
-			"LevelSequence"
+			"LevelSequence",
+			"NetCore"
 		});
 
 		PrivateDependencyModuleNames.AddRange(new[]
 		{
+			"AssetRegistry",
 			"Core",
 			"CoreUObject",
 			"DeveloperSettings",
@@ -22,9 +24,9 @@ public class Flow : ModuleRules
 			"GameplayTags",
 			"MovieScene",
 			"MovieSceneTracks",
-			"NetCore",
 			"Slate",
-			"SlateCore"
+			"SlateCore",
+			"TraceLog"
 		});
 
 		if (target.Type == TargetType.Editor)
@@ -13,6 +13,24 @@ UFlowNodeAddOn_PredicateAND::UFlowNodeAddOn_PredicateAND()
 #endif
 }
 
+void UFlowNodeAddOn_PredicateAND::InitializeInstance()
+{
+	Super::InitializeInstance();
+
+	// AddOns are instanced by now
+	if (FFlowPredicateProgram::ShouldCompileForComposite(*this))
+	{
+		PredicateProgram.CompileAND(AddOns);
+	}
+}
+
+void UFlowNodeAddOn_PredicateAND::DeinitializeInstance()
+{
+	PredicateProgram.Reset();
+
+	Super::DeinitializeInstance();
+}
+
 EFlowAddOnAcceptResult UFlowNodeAddOn_PredicateAND::AcceptFlowNodeAddOnChild_Implementation(
 	const UFlowNodeAddOn* AddOnTemplate,
 	const TArray<UFlowNodeAddOn*>& AdditionalAddOnsToAssumeAreChildren) const
@@ -31,6 +49,11 @@ EFlowAddOnAcceptResult UFlowNodeAddOn_PredicateAND::AcceptFlowNodeAddOnChild_Imp
 
 bool UFlowNodeAddOn_PredicateAND::EvaluatePredicate_Implementation() const
 {
+	if (PredicateProgram.IsCompiled())
+	{
+		return PredicateProgram.Evaluate();
+	}
+
 	return EvaluatePredicateAND(AddOns);
 }
 
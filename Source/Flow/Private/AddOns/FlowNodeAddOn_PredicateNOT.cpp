@@ -13,6 +13,24 @@ UFlowNodeAddOn_PredicateNOT::UFlowNodeAddOn_PredicateNOT()
 #endif
 }
 
+void UFlowNodeAddOn_PredicateNOT::InitializeInstance()
+{
+	Super::InitializeInstance();
+
+	// AddOns are instanced by now
+	if (FFlowPredicateProgram::ShouldCompileForComposite(*this))
+	{
+		PredicateProgram.CompileNOT(*this);
+	}
+}
+
+void UFlowNodeAddOn_PredicateNOT::DeinitializeInstance()
+{
+	PredicateProgram.Reset();
+
+	Super::DeinitializeInstance();
+}
+
 EFlowAddOnAcceptResult UFlowNodeAddOn_PredicateNOT::AcceptFlowNodeAddOnChild_Implementation(
 	const UFlowNodeAddOn* AddOnTemplate,
 	const TArray<UFlowNodeAddOn*>& AdditionalAddOnsToAssumeAreChildren) const
@@ -34,6 +52,11 @@ EFlowAddOnAcceptResult UFlowNodeAddOn_PredicateNOT::AcceptFlowNodeAddOnChild_Imp
 
 bool UFlowNodeAddOn_PredicateNOT::EvaluatePredicate_Implementation() const
 {
+	if (PredicateProgram.IsCompiled())
+	{
+		return PredicateProgram.Evaluate();
+	}
+
 	if (AddOns.IsEmpty())
 	{
 		// For parity with PredicateAND, the "no AddOns (that qualify)" case results in a "true" result
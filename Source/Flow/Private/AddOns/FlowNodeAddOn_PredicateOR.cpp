@@ -13,6 +13,24 @@ UFlowNodeAddOn_PredicateOR::UFlowNodeAddOn_PredicateOR()
 #endif
 }
 
+void UFlowNodeAddOn_PredicateOR::InitializeInstance()
+{
+	Super::InitializeInstance();
+
+	// AddOns are instanced by now
+	if (FFlowPredicateProgram::ShouldCompileForComposite(*this))
+	{
+		PredicateProgram.CompileOR(AddOns);
+	}
+}
+
+void UFlowNodeAddOn_PredicateOR::DeinitializeInstance()
+{
+	PredicateProgram.Reset();
+
+	Super::DeinitializeInstance();
+}
+
 EFlowAddOnAcceptResult UFlowNodeAddOn_PredicateOR::AcceptFlowNodeAddOnChild_Implementation(
 	const UFlowNodeAddOn* AddOnTemplate,
 	const TArray<UFlowNodeAddOn*>& AdditionalAddOnsToAssumeAreChildren) const
@@ -31,6 +49,11 @@ EFlowAddOnAcceptResult UFlowNodeAddOn_PredicateOR::AcceptFlowNodeAddOnChild_Impl
 
 bool UFlowNodeAddOn_PredicateOR::EvaluatePredicate_Implementation() const
 {
+	if (PredicateProgram.IsCompiled())
+	{
+		return PredicateProgram.Evaluate();
+	}
+
 	return EvaluatePredicateOR(AddOns);
 }
 
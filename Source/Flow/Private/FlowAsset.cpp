@@ -2,9 +2,12 @@
 
 #include "FlowAsset.h"
 
+#include "FlowComponent.h"
 #include "FlowLogChannels.h"
 #include "FlowSettings.h"
+#include "FlowStats.h"
 #include "FlowSubsystem.h"
+#include "FlowTrace.h"
 
 #include "AddOns/FlowNodeAddOn.h"
 #include "Interfaces/FlowDataPinGeneratorNodeInterface.h"
@@ -14,6 +17,7 @@
 #include "Nodes/Graph/FlowNode_Start.h"
 #include "Nodes/Graph/FlowNode_SubGraph.h"
 
+#include "Algo/BinarySearch.h"
 #include "Engine/World.h"
 #include "Serialization/MemoryReader.h"
 #include "Serialization/MemoryWriter.h"
@@ -48,6 +52,28 @@ UFlowAsset::UFlowAsset(const FObjectInitializer& ObjectInitializer)
 	ExpectedOwnerClass = UFlowSettings::Get()->GetDefaultExpectedOwnerClass();
 }
 
+void UFlowAsset::Serialize(FArchive& Ar)
+{
+	Super::Serialize(Ar);
+
+	// Lookup tables follow tagged properties only in packages filtering editor-only data, i.e. cooked packages
+	// Loading a cooked package sets this filter from package flags, so reading matches what was written
+	if (Ar.IsFilterEditorOnly() && (Ar.IsLoading() || Ar.IsSaving()) && !Ar.IsCountingMemory())
+	{
+#if WITH_EDITOR
+		if (Ar.IsSaving() && Ar.IsCooking())
+		{
+			FFlowAssetCookedData SavedCookedData;
+			BuildCookedData(SavedCookedData);
+			FFlowAssetCookedData::StaticStruct()->SerializeItem(Ar, &SavedCookedData, nullptr);
+			return;
+		}
+#endif
+
+		FFlowAssetCookedData::StaticStruct()->SerializeItem(Ar, &CookedData, nullptr);
+	}
+}
+
 #if WITH_EDITOR
 void UFlowAsset::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
 {
@@ -103,6 +129,38 @@ void UFlowAsset::PostLoad()
 	}
 }
 
+void UFlowAsset::BuildCookedData(FFlowAssetCookedData& OutCookedData) const
+{
+	// GetDefaultEntryNode and custom event lookups iterate the Nodes, as CookedData is never valid in the editor
+	if (const UFlowNode* DefaultEntryNode = GetDefaultEntryNode())
+	{
+		OutCookedData.DefaultEntryNodeGuid = DefaultEntryNode->GetGuid();
+	}
+
+	for (const TPair<FGuid, UFlowNode*>& Node : ObjectPtrDecay(Nodes))
+	{
+		if (const UFlowNode_CustomInput* CustomInput = Cast<UFlowNode_CustomInput>(Node.Value))
+		{
+			if (!CustomInput->GetEventName().IsNone() && !OutCookedData.CustomInputNodeGuids.Contains(CustomInput->GetEventName()))
+			{
+				OutCookedData.CustomInputNodeGuids.Add(CustomInput->GetEventName(), Node.Key);
+			}
+		}
+		else if (const UFlowNode_CustomOutput* CustomOutput = Cast<UFlowNode_CustomOutput>(Node.Value))
+		{
+			if (!CustomOutput->GetEventName().IsNone() && !OutCookedData.CustomOutputNodeGuids.Contains(CustomOutput->GetEventName()))
+			{
+				OutCookedData.CustomOutputNodeGuids.Add(CustomOutput->GetEventName(), Node.Key);
+			}
+		}
+	}
+
+	Nodes.GenerateKeyArray(OutCookedData.SortedNodeGuids);
+	OutCookedData.SortedNodeGuids.Sort();
+
+	OutCookedData.bValid = true;
+}
+
 EDataValidationResult UFlowAsset::ValidateAsset(FFlowMessageLog& MessageLog)
 {
 	// validate nodes
@@ -301,8 +359,25 @@ void UFlowAsset::RegisterNode(const FGuid& NewGuid, UFlowNode* NewNode)
 {
 	NewNode->SetGuid(NewGuid);
 	Nodes.Emplace(NewGuid, NewNode);
+	SortedNodeGuids.Reset();
+
+	// Linked nodes might have harvested connections to this node before its guid was assigned, i.e. while pasting nodes
+	MarkNodeConnectionsDirty(NewGuid);
+	if (const UEdGraphNode* GraphNode = NewNode->GetGraphNode())
+	{
+		for (const UEdGraphPin* Pin : GraphNode->Pins)
+		{
+			for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+			{
+				if (LinkedPin && LinkedPin->GetOwningNodeUnchecked())
+				{
+					MarkNodeConnectionsDirty(LinkedPin->GetOwningNodeUnchecked()->NodeGuid);
+				}
+			}
+		}
+	}
 
-	HarvestNodeConnections();
+	HarvestDirtyNodeConnections();
 
 	if (TryUpdateManagedFlowPinsForNode(*NewNode))
 	{
@@ -314,12 +389,59 @@ void UFlowAsset::UnregisterNode(const FGuid& NodeGuid)
 {
 	Nodes.Remove(NodeGuid);
 	Nodes.Compact();
+	SortedNodeGuids.Reset();
+	DirtyConnectionNodes.Remove(NodeGuid);
 
-	HarvestNodeConnections();
+	// Only nodes connected to the removed node need to harvest their connections again
+	for (const TPair<FGuid, UFlowNode*>& Pair : ObjectPtrDecay(Nodes))
+	{
+		if (Pair.Value == nullptr)
+		{
+			continue;
+		}
+
+		for (const TPair<FName, FConnectedPin>& Connection : Pair.Value->Connections)
+		{
+			if (Connection.Value.NodeGuid == NodeGuid)
+			{
+				MarkNodeConnectionsDirty(Pair.Key);
+				break;
+			}
+		}
+	}
+
+	HarvestDirtyNodeConnections();
 
 	MarkPackageDirty();
 }
 
+void UFlowAsset::HarvestDirtyNodeConnections()
+{
+	if (bAllNodeConnectionsDirty)
+	{
+		HarvestNodeConnections();
+		return;
+	}
+
+	if (DirtyConnectionNodes.IsEmpty())
+	{
+		return;
+	}
+
+	const TArray<FGuid> DirtyNodeGuids = DirtyConnectionNodes.Array();
+	DirtyConnectionNodes.Reset();
+
+	for (const FGuid& NodeGuid : DirtyNodeGuids)
+	{
+		// nodes might not be registered yet, they're harvested on registration then
+		UFlowNode* FlowNode = Nodes.FindRef(NodeGuid);
+		if (IsValid(FlowNode) && FlowNode->GetGraphNode())
+		{
+			HarvestNodeConnections(FlowNode);
+		}
+	}
+}
+
 void UFlowAsset::HarvestNodeConnections(UFlowNode* TargetNode)
 {
 	TArray<UFlowNode*> TargetNodes;
@@ -328,9 +450,14 @@ void UFlowAsset::HarvestNodeConnections(UFlowNode* TargetNode)
 	{
 		TargetNodes.Reserve(1);
 		TargetNodes.Add(TargetNode);
+
+		DirtyConnectionNodes.Remove(TargetNode->GetGuid());
 	}
 	else
 	{
+		bAllNodeConnectionsDirty = false;
+		DirtyConnectionNodes.Reset();
+
 		TargetNodes.Reserve(Nodes.Num());
 		for (const TPair<FGuid, UFlowNode*>& Pair : ObjectPtrDecay(Nodes))
 		{
@@ -883,8 +1010,44 @@ bool UFlowAsset::TryCreateFlowDataPinFromMetadataValue(
 
 #endif
 
+const TArray<FGuid>& UFlowAsset::GetSortedNodeGuids() const
+{
+#if !WITH_EDITOR
+	if (CookedData.bValid)
+	{
+		return CookedData.SortedNodeGuids;
+	}
+#endif
+
+	if (SortedNodeGuids.Num() != Nodes.Num())
+	{
+		Nodes.GenerateKeyArray(SortedNodeGuids);
+		SortedNodeGuids.Sort();
+	}
+
+	return SortedNodeGuids;
+}
+
+int32 UFlowAsset::GetNodeReplicationIndex(const FGuid& Guid) const
+{
+	return Algo::BinarySearch(GetSortedNodeGuids(), Guid);
+}
+
+UFlowNode* UFlowAsset::GetNodeByReplicationIndex(const int32 Index) const
+{
+	const TArray<FGuid>& Guids = GetSortedNodeGuids();
+	return Guids.IsValidIndex(Index) ? Nodes.FindRef(Guids[Index]) : nullptr;
+}
+
 UFlowNode* UFlowAsset::GetDefaultEntryNode() const
 {
+#if !WITH_EDITOR
+	if (CookedData.bValid)
+	{
+		return Nodes.FindRef(CookedData.DefaultEntryNodeGuid);
+	}
+#endif
+
 	UFlowNode* FirstStartNode = nullptr;
 
 	for (const TPair<FGuid, UFlowNode*>& Node : ObjectPtrDecay(Nodes))
@@ -942,6 +1105,14 @@ void UFlowAsset::RemoveCustomOutput(const FName& EventName)
 
 UFlowNode_CustomInput* UFlowAsset::TryFindCustomInputNodeByEventName(const FName& EventName) const
 {
+#if !WITH_EDITOR
+	if (CookedData.bValid)
+	{
+		const FGuid* NodeGuid = CookedData.CustomInputNodeGuids.Find(EventName);
+		return NodeGuid ? Cast<UFlowNode_CustomInput>(Nodes.FindRef(*NodeGuid)) : nullptr;
+	}
+#endif
+
 	for (const TPair<FGuid, UFlowNode*>& Node : ObjectPtrDecay(Nodes))
 	{
 		if (UFlowNode_CustomInput* CustomInput = Cast<UFlowNode_CustomInput>(Node.Value))
@@ -958,6 +1129,14 @@ UFlowNode_CustomInput* UFlowAsset::TryFindCustomInputNodeByEventName(const FName
 
 UFlowNode_CustomOutput* UFlowAsset::TryFindCustomOutputNodeByEventName(const FName& EventName) const
 {
+#if !WITH_EDITOR
+	if (CookedData.bValid)
+	{
+		const FGuid* NodeGuid = CookedData.CustomOutputNodeGuids.Find(EventName);
+		return NodeGuid ? Cast<UFlowNode_CustomOutput>(Nodes.FindRef(*NodeGuid)) : nullptr;
+	}
+#endif
+
 	for (const TPair<FGuid, UFlowNode*>& Node : ObjectPtrDecay(Nodes))
 	{
 		if (UFlowNode_CustomOutput* CustomOutput = Cast<UFlowNode_CustomOutput>(Node.Value))
@@ -1050,6 +1229,11 @@ void UFlowAsset::AddInstance(UFlowAsset* Instance)
 	ActiveInstances.Add(Instance);
 }
 
+void UFlowAsset::ReserveInstances(const int32 AdditionalInstances)
+{
+	ActiveInstances.Reserve(ActiveInstances.Num() + AdditionalInstances);
+}
+
 int32 UFlowAsset::RemoveInstance(UFlowAsset* Instance)
 {
 #if WITH_EDITOR
@@ -1083,6 +1267,21 @@ void UFlowAsset::ClearInstances()
 	ActiveInstances.Empty();
 }
 
+#if !UE_BUILD_SHIPPING
+void UFlowAsset::GetMemoryFootprint(FFlowMemoryFootprint& OutFootprint) const
+{
+	OutFootprint.AssetObject += FFlowMemoryFootprint::GetObjectBytes(this);
+
+	for (const TPair<FGuid, UFlowNode*>& Node : ObjectPtrDecay(Nodes))
+	{
+		if (Node.Value)
+		{
+			Node.Value->GetMemoryFootprint(OutFootprint);
+		}
+	}
+}
+#endif
+
 #if WITH_EDITOR
 void UFlowAsset::GetInstanceDisplayNames(TArray<TSharedPtr<FName>>& OutDisplayNames) const
 {
@@ -1129,11 +1328,17 @@ void UFlowAsset::BroadcastRuntimeMessageAdded(const TSharedRef<FTokenizedMessage
 
 void UFlowAsset::InitializeInstance(const TWeakObjectPtr<UObject> InOwner, UFlowAsset& InTemplateAsset)
 {
+	SCOPE_CYCLE_COUNTER(STAT_FlowInitializeInstance);
+	CSV_SCOPED_TIMING_STAT(Flow, InitializeInstance);
+
 	check(!IsInstanceInitialized());
 
 	Owner = InOwner;
 	TemplateAsset = &InTemplateAsset;
 
+	// not a property, so it isn't copied from the template by NewObject
+	CookedData = InTemplateAsset.CookedData;
+
 	for (TPair<FGuid, TObjectPtr<UFlowNode>>& Node : Nodes)
 	{
 		UFlowNode* NewNodeInstance = NewObject<UFlowNode>(this, Node.Value->GetClass(), NAME_None, RF_Transient, Node.Value, false, nullptr);
@@ -1149,16 +1354,28 @@ void UFlowAsset::InitializeInstance(const TWeakObjectPtr<UObject> InOwner, UFlow
 
 		NewNodeInstance->InitializeInstance();
 	}
+
+	FFlowStats::OnInstanceInitialized();
+	TRACE_FLOW_INSTANCE_CREATED(*this);
 }
 
 void UFlowAsset::DeinitializeInstance()
 {
 	if (IsInstanceInitialized())
 	{
+		FFlowStats::OnInstanceDeinitialized();
+		TRACE_FLOW_INSTANCE_DESTROYED(*this);
+
 		for (const TPair<FGuid, UFlowNode*>& Node : ObjectPtrDecay(Nodes))
 		{
 			if (IsValid(Node.Value))
 			{
+				// nodes weren't deactivated if instance is removed without finishing, e.g. on world cleanup
+				if (Node.Value->ActivationState == EFlowNodeState::Active)
+				{
+					FFlowStats::OnNodeDeactivated();
+				}
+
 				Node.Value->DeinitializeInstance();
 			}
 		}
@@ -1247,6 +1464,14 @@ void UFlowAsset::FinishFlow(const EFlowFinishPolicy InFinishPolicy, const bool b
 	// provides option to finish game-specific logic prior to removing asset instance 
 	if (bRemoveInstance)
 	{
+		if (!NodeOwningThisAssetInstance.IsValid())
+		{
+			if (UFlowComponent* FlowComponent = Cast<UFlowComponent>(GetOwner()))
+			{
+				FlowComponent->RemoveReplicatedNodeStates(*this);
+			}
+		}
+
 		DeinitializeInstance();
 	}
 }
@@ -1381,6 +1606,18 @@ void UFlowAsset::ResetNodes()
 	RecordedNodes.Empty();
 }
 
+void UFlowAsset::OnNodeActivationStateChanged(const UFlowNode& Node) const
+{
+	// only Root Flow instances are mirrored on clients
+	if (!NodeOwningThisAssetInstance.IsValid())
+	{
+		if (UFlowComponent* FlowComponent = Cast<UFlowComponent>(GetOwner()))
+		{
+			FlowComponent->UpdateReplicatedNodeState(*this, Node);
+		}
+	}
+}
+
 UFlowSubsystem* UFlowAsset::GetFlowSubsystem() const
 {
 	return Cast<UFlowSubsystem>(GetOuter());
@@ -1478,6 +1715,8 @@ void UFlowAsset::OnActivationStateLoaded(UFlowNode* Node)
 	{
 		ActiveNodes.Emplace(Node);
 	}
+
+	OnNodeActivationStateChanged(*Node);
 }
 
 void UFlowAsset::OnSave_Implementation()
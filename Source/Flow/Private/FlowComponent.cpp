@@ -24,10 +24,14 @@ UFlowComponent::UFlowComponent(const FObjectInitializer& ObjectInitializer)
 	, bAutoStartRootFlow(true)
 	, RootFlowMode(EFlowNetMode::Authority)
 	, bAllowMultipleInstances(true)
+	, bReplicateRootFlowNodeStates(false)
+	, bNotifyBatchReplicated(false)
 {
 	PrimaryComponentTick.bCanEverTick = false;
 	PrimaryComponentTick.bStartWithTickEnabled = false;
 
+	ReplicatedNodeStates.OwnerComponent = this;
+
 	SetIsReplicatedByDefault(true);
 }
 
@@ -40,19 +44,26 @@ void UFlowComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLi
 	Params.bIsPushBased = true;
 
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, IdentityTags, Params);
-
-	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, RecentlySentNotifyTags, Params);
-	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, NotifyTagsFromGraph, Params);
-	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, NotifyTagsFromAnotherComponent, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, NotifyBatch, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, ReplicatedNodeStates, Params);
 #else
 	DOREPLIFETIME(ThisClass, IdentityTags);
-
-	DOREPLIFETIME(ThisClass, RecentlySentNotifyTags);
-	DOREPLIFETIME(ThisClass, NotifyTagsFromGraph);
-	DOREPLIFETIME(ThisClass, NotifyTagsFromAnotherComponent);
+	DOREPLIFETIME(ThisClass, NotifyBatch);
+	DOREPLIFETIME(ThisClass, ReplicatedNodeStates);
 #endif
 }
 
+void UFlowComponent::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	Super::PreReplication(ChangedPropertyTracker);
+
+	// current batch is going to be sent with this net update, next notify starts a new batch
+	if (NotifyBatch.Notifies.Num() > 0)
+	{
+		bNotifyBatchReplicated = true;
+	}
+}
+
 void UFlowComponent::BeginPlay()
 {
 	Super::BeginPlay();
@@ -100,7 +111,9 @@ void UFlowComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 
 void UFlowComponent::UnregisterWithFlowSubsystem()
 {
-	if (UFlowSubsystem* FlowSubsystem = GetFlowSubsystem())
+	// component might have been already unregistered together with its whole level
+	UFlowSubsystem* FlowSubsystem = GetFlowSubsystem();
+	if (FlowSubsystem && FlowSubsystem->IsComponentRegistered(this))
 	{
 		FlowSubsystem->FinishAllRootFlows(this, EFlowFinishPolicy::Keep);
 		FlowSubsystem->UnregisterComponent(this);
@@ -315,16 +328,14 @@ void UFlowComponent::NotifyGraph(const FGameplayTag NotifyTag, const EFlowNetMod
 	if (IsFlowNetMode(NetMode) && NotifyTag.IsValid() && HasBegunPlay())
 	{
 		// save recently notify, this allows for the retroactive check in nodes
-		// if retroactive check wouldn't be performed, this is only used by the network replication
 		RecentlySentNotifyTags = FGameplayTagContainer(NotifyTag);
-#if WITH_PUSH_MODEL
+
 		if (IsNetMode(NM_DedicatedServer) || IsNetMode(NM_ListenServer))
 		{
-			MARK_PROPERTY_DIRTY_FROM_NAME(UFlowComponent, RecentlySentNotifyTags, this);
+			EnqueueReplicatedNotify(EFlowNotifyChannel::SentToGraph, FGameplayTag::EmptyTag, RecentlySentNotifyTags);
 		}
-#endif
 
-		OnRep_SentNotifyTags();
+		BroadcastSentNotifyTags();
 	}
 }
 
@@ -344,21 +355,19 @@ void UFlowComponent::BulkNotifyGraph(const FGameplayTagContainer NotifyTags, con
 		if (ValidatedTags.Num() > 0)
 		{
 			// save recently notify, this allows for the retroactive check in nodes
-			// if retroactive check wouldn't be performed, this is only used by the network replication
 			RecentlySentNotifyTags = ValidatedTags;
-#if WITH_PUSH_MODEL
+
 			if (IsNetMode(NM_DedicatedServer) || IsNetMode(NM_ListenServer))
 			{
-				MARK_PROPERTY_DIRTY_FROM_NAME(UFlowComponent, RecentlySentNotifyTags, this);
+				EnqueueReplicatedNotify(EFlowNotifyChannel::SentToGraph, FGameplayTag::EmptyTag, RecentlySentNotifyTags);
 			}
-#endif
 
-			OnRep_SentNotifyTags();
+			BroadcastSentNotifyTags();
 		}
 	}
 }
 
-void UFlowComponent::OnRep_SentNotifyTags()
+void UFlowComponent::BroadcastSentNotifyTags()
 {
 	for (const FGameplayTag& NotifyTag : RecentlySentNotifyTags)
 	{
@@ -388,56 +397,84 @@ void UFlowComponent::NotifyFromGraph(const FGameplayTagContainer& NotifyTags, co
 
 			if (IsNetMode(NM_DedicatedServer) || IsNetMode(NM_ListenServer))
 			{
-				NotifyTagsFromGraph = ValidatedTags;
-#if WITH_PUSH_MODEL
-				MARK_PROPERTY_DIRTY_FROM_NAME(UFlowComponent, NotifyTagsFromGraph, this);
-#endif
+				EnqueueReplicatedNotify(EFlowNotifyChannel::FromGraph, FGameplayTag::EmptyTag, ValidatedTags);
 			}
 		}
 	}
 }
 
-void UFlowComponent::OnRep_NotifyTagsFromGraph()
+void UFlowComponent::NotifyActor(const FGameplayTag ActorTag, const FGameplayTag NotifyTag, const EFlowNetMode NetMode /* = EFlowNetMode::Authority*/)
 {
-	for (const FGameplayTag& NotifyTag : NotifyTagsFromGraph)
+	if (IsFlowNetMode(NetMode) && NotifyTag.IsValid() && HasBegunPlay())
 	{
-		ReceiveNotify.Broadcast(nullptr, NotifyTag);
+		BroadcastNotifyToActors(ActorTag, NotifyTag);
+
+		if (IsNetMode(NM_DedicatedServer) || IsNetMode(NM_ListenServer))
+		{
+			EnqueueReplicatedNotify(EFlowNotifyChannel::FromAnotherComponent, ActorTag, FGameplayTagContainer(NotifyTag));
+		}
 	}
 }
 
-void UFlowComponent::NotifyActor(const FGameplayTag ActorTag, const FGameplayTag NotifyTag, const EFlowNetMode NetMode /* = EFlowNetMode::Authority*/)
+void UFlowComponent::BroadcastNotifyToActors(const FGameplayTag& ActorTag, const FGameplayTag& NotifyTag)
 {
-	if (IsFlowNetMode(NetMode) && NotifyTag.IsValid() && HasBegunPlay())
+	if (const UFlowSubsystem* FlowSubsystem = GetFlowSubsystem())
 	{
-		if (const UFlowSubsystem* FlowSubsystem = GetFlowSubsystem())
+		for (const TWeakObjectPtr<UFlowComponent>& Component : FlowSubsystem->GetComponents<UFlowComponent>(ActorTag))
 		{
-			for (const TWeakObjectPtr<UFlowComponent>& Component : FlowSubsystem->GetComponents<UFlowComponent>(ActorTag))
-			{
-				Component->ReceiveNotify.Broadcast(this, NotifyTag);
-			}
+			Component->ReceiveNotify.Broadcast(this, NotifyTag);
 		}
+	}
+}
 
-		if (IsNetMode(NM_DedicatedServer) || IsNetMode(NM_ListenServer))
-		{
-			NotifyTagsFromAnotherComponent.Empty();
-			NotifyTagsFromAnotherComponent.Add(FNotifyTagReplication(ActorTag, NotifyTag));
+void UFlowComponent::EnqueueReplicatedNotify(const EFlowNotifyChannel Channel, const FGameplayTag& ActorTag, const FGameplayTagContainer& NotifyTags)
+{
+	// previous batch has been already sent, start a new one
+	if (bNotifyBatchReplicated)
+	{
+		NotifyBatch.Notifies.Reset();
+		++NotifyBatch.BatchId;
+		bNotifyBatchReplicated = false;
+	}
+
+	// mark dirty only once per batch, all notifies sent before the next net update are going to be replicated together
+	if (NotifyBatch.Notifies.Num() == 0)
+	{
 #if WITH_PUSH_MODEL
-			MARK_PROPERTY_DIRTY_FROM_NAME(UFlowComponent, NotifyTagsFromAnotherComponent, this);
+		MARK_PROPERTY_DIRTY_FROM_NAME(UFlowComponent, NotifyBatch, this);
 #endif
-		}
 	}
+
+	NotifyBatch.Notifies.Emplace(Channel, ActorTag, NotifyTags);
 }
 
-void UFlowComponent::OnRep_NotifyTagsFromAnotherComponent()
+void UFlowComponent::OnRep_NotifyBatch()
 {
-	if (const UFlowSubsystem* FlowSubsystem = GetFlowSubsystem())
+	FLOW_ASSERT_ENUM_MAX(EFlowNotifyChannel, 3);
+
+	// replay notifies in the order they were sent on the server
+	for (const FFlowQueuedNotify& Notify : NotifyBatch.Notifies)
 	{
-		for (const FNotifyTagReplication& Notify : NotifyTagsFromAnotherComponent)
+		switch (Notify.Channel)
 		{
-			for (const TWeakObjectPtr<UFlowComponent>& Component : FlowSubsystem->GetComponents<UFlowComponent>(Notify.ActorTag))
-			{
-				Component->ReceiveNotify.Broadcast(this, Notify.NotifyTag);
-			}
+			case EFlowNotifyChannel::SentToGraph:
+				RecentlySentNotifyTags = Notify.NotifyTags;
+				BroadcastSentNotifyTags();
+				break;
+			case EFlowNotifyChannel::FromGraph:
+				for (const FGameplayTag& NotifyTag : Notify.NotifyTags)
+				{
+					ReceiveNotify.Broadcast(nullptr, NotifyTag);
+				}
+				break;
+			case EFlowNotifyChannel::FromAnotherComponent:
+				for (const FGameplayTag& NotifyTag : Notify.NotifyTags)
+				{
+					BroadcastNotifyToActors(Notify.ActorTag, NotifyTag);
+				}
+				break;
+			default:
+				break;
 		}
 	}
 }
@@ -489,6 +526,124 @@ UFlowAsset* UFlowComponent::GetRootFlowInstance() const
 	return nullptr;
 }
 
+TArray<FName> UFlowComponent::GetReplicatedInstanceNames(const UFlowAsset* TemplateAsset) const
+{
+	TArray<FName> Result;
+
+	if (IsValid(TemplateAsset))
+	{
+		for (const FFlowReplicatedNodeState& NodeState : ReplicatedNodeStates.Items)
+		{
+			if (NodeState.TemplateAsset == TemplateAsset)
+			{
+				Result.AddUnique(NodeState.InstanceName);
+			}
+		}
+	}
+
+	return Result;
+}
+
+EFlowNodeState UFlowComponent::GetReplicatedNodeState(const UFlowAsset* TemplateAsset, const FGuid& NodeGuid, const FName InstanceName /* = NAME_None */) const
+{
+	if (IsValid(TemplateAsset))
+	{
+		const int32 NodeIndex = TemplateAsset->GetNodeReplicationIndex(NodeGuid);
+		if (NodeIndex != INDEX_NONE)
+		{
+			if (!InstanceName.IsNone())
+			{
+				if (const FFlowReplicatedNodeState* NodeState = ReplicatedNodeStates.Find(InstanceName, static_cast<uint16>(NodeIndex)))
+				{
+					return NodeState->State;
+				}
+			}
+			else
+			{
+				EFlowNodeState Result = EFlowNodeState::NeverActivated;
+				for (const FFlowReplicatedNodeState& NodeState : ReplicatedNodeStates.Items)
+				{
+					if (NodeState.TemplateAsset == TemplateAsset && NodeState.NodeIndex == NodeIndex)
+					{
+						if (NodeState.State == EFlowNodeState::Active)
+						{
+							return NodeState.State;
+						}
+						Result = NodeState.State;
+					}
+				}
+				return Result;
+			}
+		}
+	}
+
+	return EFlowNodeState::NeverActivated;
+}
+
+TArray<UFlowNode*> UFlowComponent::GetReplicatedActiveNodes(const UFlowAsset* TemplateAsset, const FName InstanceName /* = NAME_None */) const
+{
+	TArray<UFlowNode*> Result;
+
+	if (IsValid(TemplateAsset))
+	{
+		for (const FFlowReplicatedNodeState& NodeState : ReplicatedNodeStates.Items)
+		{
+			if (NodeState.TemplateAsset == TemplateAsset && NodeState.State == EFlowNodeState::Active
+				&& (InstanceName.IsNone() || NodeState.InstanceName == InstanceName))
+			{
+				if (UFlowNode* TemplateNode = TemplateAsset->GetNodeByReplicationIndex(NodeState.NodeIndex))
+				{
+					Result.AddUnique(TemplateNode);
+				}
+			}
+		}
+	}
+
+	return Result;
+}
+
+void UFlowComponent::UpdateReplicatedNodeState(const UFlowAsset& RootFlowInstance, const UFlowNode& Node)
+{
+	if (!bReplicateRootFlowNodeStates || !GetOwner()->HasAuthority())
+	{
+		return;
+	}
+
+	UFlowAsset* TemplateAsset = RootFlowInstance.GetTemplateAsset();
+	const int32 NodeIndex = IsValid(TemplateAsset) ? TemplateAsset->GetNodeReplicationIndex(Node.GetGuid()) : INDEX_NONE;
+	if (NodeIndex == INDEX_NONE || NodeIndex > MAX_uint16)
+	{
+		return;
+	}
+
+	const FName InstanceName = RootFlowInstance.GetFName();
+	if (ReplicatedNodeStates.SetState(TemplateAsset, InstanceName, static_cast<uint16>(NodeIndex), Node.GetActivationState()))
+	{
+#if WITH_PUSH_MODEL
+		MARK_PROPERTY_DIRTY_FROM_NAME(UFlowComponent, ReplicatedNodeStates, this);
+#endif
+		OnRootFlowNodeStateChanged.Broadcast(this, TemplateAsset, InstanceName, TemplateAsset->GetNodeByReplicationIndex(NodeIndex), Node.GetActivationState());
+	}
+}
+
+void UFlowComponent::RemoveReplicatedNodeStates(const UFlowAsset& RootFlowInstance)
+{
+	if (bReplicateRootFlowNodeStates && GetOwner()->HasAuthority() && ReplicatedNodeStates.RemoveAll(RootFlowInstance.GetFName()))
+	{
+#if WITH_PUSH_MODEL
+		MARK_PROPERTY_DIRTY_FROM_NAME(UFlowComponent, ReplicatedNodeStates, this);
+#endif
+	}
+}
+
+void UFlowComponent::BroadcastReplicatedNodeState(UFlowAsset* TemplateAsset, const FName InstanceName, const uint16 NodeIndex, const EFlowNodeState State)
+{
+	if (IsValid(TemplateAsset))
+	{
+		OnRootFlowNodeStateChanged.Broadcast(this, TemplateAsset, InstanceName, TemplateAsset->GetNodeByReplicationIndex(NodeIndex), State);
+	}
+}
+
 void UFlowComponent::TriggerRootFlowCustomInput(const FName& EventName) const
 {
 	if (RootFlow && IsFlowNetMode(RootFlowMode))
@@ -0,0 +1,103 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "FlowPreloadManifest.h"
+#include "FlowAsset.h"
+#include "FlowSubsystem.h"
+
+#if WITH_EDITOR
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/BlueprintCore.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#endif
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FlowPreloadManifest)
+
+#if WITH_EDITOR
+void UFlowPreloadManifest::GatherFromSourceMaps()
+{
+	const IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+
+	TArray<FName> PackagesToScan;
+	for (const TSoftObjectPtr<UWorld>& SourceMap : SourceMaps)
+	{
+		if (SourceMap.IsNull())
+		{
+			continue;
+		}
+
+		const FString MapPackageName = SourceMap.ToSoftObjectPath().GetLongPackageName();
+		PackagesToScan.Emplace(*MapPackageName);
+
+		// actors of World Partition maps are saved in their own packages, not referenced by the map package
+		TArray<FAssetData> ExternalActors;
+		AssetRegistry.GetAssetsByPath(*ULevel::GetExternalActorsPath(MapPackageName), ExternalActors, true);
+		for (const FAssetData& ExternalActor : ExternalActors)
+		{
+			PackagesToScan.AddUnique(ExternalActor.PackageName);
+		}
+	}
+
+	TSet<FName> ScannedPackages(PackagesToScan);
+	TArray<FSoftObjectPath> FoundTemplates;
+
+	// only dependencies of maps, Flow Assets and Blueprints are followed, walking every dependency would visit most of the project
+	// Blueprints are needed to find Flow Assets assigned to class defaults, i.e. Root Flow of a Flow Component placed in actor Blueprint
+	while (PackagesToScan.Num() > 0)
+	{
+		const FName PackageName = PackagesToScan.Pop();
+
+		TArray<FName> Dependencies;
+		AssetRegistry.GetDependencies(PackageName, Dependencies, UE::AssetRegistry::EDependencyCategory::Package);
+
+		for (const FName& Dependency : Dependencies)
+		{
+			bool bAlreadyScanned = false;
+			ScannedPackages.Add(Dependency, &bAlreadyScanned);
+			if (bAlreadyScanned)
+			{
+				continue;
+			}
+
+			TArray<FAssetData> Assets;
+			AssetRegistry.GetAssetsByPackageName(Dependency, Assets);
+			for (const FAssetData& AssetData : Assets)
+			{
+				const UClass* AssetClass = AssetData.GetClass();
+				if (AssetClass == nullptr)
+				{
+					continue;
+				}
+
+				if (AssetClass->IsChildOf(UFlowAsset::StaticClass()))
+				{
+					FoundTemplates.Emplace(AssetData.GetSoftObjectPath());
+					PackagesToScan.AddUnique(Dependency);
+				}
+				else if (AssetClass->IsChildOf(UBlueprintCore::StaticClass()) || AssetClass->IsChildOf(UBlueprintGeneratedClass::StaticClass()))
+				{
+					PackagesToScan.AddUnique(Dependency);
+				}
+			}
+		}
+	}
+
+	AddTemplates(FoundTemplates);
+}
+
+void UFlowPreloadManifest::GatherFromRecordedUsage()
+{
+	AddTemplates(UFlowSubsystem::GetRecordedTemplateUsage().Array());
+}
+
+void UFlowPreloadManifest::AddTemplates(const TArray<FSoftObjectPath>& TemplatePaths)
+{
+	Modify();
+
+	for (const FSoftObjectPath& TemplatePath : TemplatePaths)
+	{
+		Templates.AddUnique(TSoftObjectPtr<UFlowAsset>(TemplatePath));
+	}
+}
+#endif
@@ -11,6 +11,11 @@ UFlowSettings::UFlowSettings(const FObjectInitializer& ObjectInitializer)
 	, bWarnAboutMissingIdentityTags(true)
 	, bLogOnSignalDisabled(true)
 	, bLogOnSignalPassthrough(true)
+	, MaxPooledLevelSequenceActors(4)
+	, bEnableNodeClassStatScopes(false)
+	, bEnableSpatialComponentQueries(false)
+	, SpatialQueryCellSize(5000.0f)
+	, bBulkUnregisterOnLevelRemoval(false)
 	, bUseAdaptiveNodeTitles(false)
 	, DefaultExpectedOwnerClass(UFlowComponent::StaticClass())
 {
@@ -0,0 +1,106 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "FlowStats.h"
+#include "FlowSettings.h"
+
+DEFINE_STAT(STAT_FlowExecuteInput);
+DEFINE_STAT(STAT_FlowInitializeInstance);
+DEFINE_STAT(STAT_FlowResolveDataPin);
+
+DEFINE_STAT(STAT_FlowNodeActivations);
+DEFINE_STAT(STAT_FlowActiveInstances);
+DEFINE_STAT(STAT_FlowActiveNodes);
+
+CSV_DEFINE_CATEGORY_MODULE(FLOW_API, Flow, true);
+CSV_DEFINE_CATEGORY_MODULE(FLOW_API, FlowNodeClasses, true);
+
+int32 FFlowStats::ActiveInstances = 0;
+int32 FFlowStats::ActiveNodes = 0;
+
+void FFlowStats::OnInstanceInitialized()
+{
+	ActiveInstances++;
+	UpdateActiveCounters();
+}
+
+void FFlowStats::OnInstanceDeinitialized()
+{
+	ActiveInstances = FMath::Max(0, ActiveInstances - 1);
+	UpdateActiveCounters();
+}
+
+void FFlowStats::OnNodeActivated()
+{
+	INC_DWORD_STAT(STAT_FlowNodeActivations);
+	CSV_CUSTOM_STAT(Flow, NodeActivations, 1, ECsvCustomStatOp::Accumulate);
+
+	ActiveNodes++;
+	UpdateActiveCounters();
+}
+
+void FFlowStats::OnNodeDeactivated()
+{
+	ensureMsgf(ActiveNodes > 0, TEXT("Node deactivated without being counted as active"));
+	ActiveNodes--;
+	UpdateActiveCounters();
+}
+
+void FFlowStats::OnNodeRestored()
+{
+	ActiveNodes++;
+	UpdateActiveCounters();
+}
+
+void FFlowStats::UpdateActiveCounters()
+{
+	SET_DWORD_STAT(STAT_FlowActiveInstances, ActiveInstances);
+	SET_DWORD_STAT(STAT_FlowActiveNodes, ActiveNodes);
+
+	CSV_CUSTOM_STAT(Flow, ActiveInstances, ActiveInstances, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(Flow, ActiveNodes, ActiveNodes, ECsvCustomStatOp::Set);
+}
+
+FFlowNodeClassStatScope::FFlowNodeClassStatScope(const UObject& NodeOrAddOn)
+{
+#if STATS || CSV_PROFILER
+	if (!UFlowSettings::Get()->bEnableNodeClassStatScopes)
+	{
+		return;
+	}
+#endif
+
+#if STATS
+	CycleCounter.Emplace(GetClassStatId(*NodeOrAddOn.GetClass()));
+#endif
+
+#if CSV_PROFILER
+	CsvStatName = NodeOrAddOn.GetClass()->GetFName();
+	FCsvProfiler::BeginStat(CsvStatName, CSV_CATEGORY_INDEX(FlowNodeClasses));
+#endif
+}
+
+FFlowNodeClassStatScope::~FFlowNodeClassStatScope()
+{
+#if CSV_PROFILER
+	if (!CsvStatName.IsNone())
+	{
+		FCsvProfiler::EndStat(CsvStatName, CSV_CATEGORY_INDEX(FlowNodeClasses));
+	}
+#endif
+}
+
+#if STATS
+TStatId FFlowNodeClassStatScope::GetClassStatId(const UClass& Class)
+{
+	// game thread only, like the node execution it measures
+	static TMap<FName, TStatId> ClassStatIds;
+
+	const FName ClassName = Class.GetFName();
+	if (const TStatId* StatId = ClassStatIds.Find(ClassName))
+	{
+		return *StatId;
+	}
+
+	return ClassStatIds.Add(ClassName, FDynamicStats::CreateStatId<FStatGroup_STATGROUP_Flow>(ClassName));
+}
+#endif
@@ -5,15 +5,19 @@
 #include "FlowAsset.h"
 #include "FlowComponent.h"
 #include "FlowLogChannels.h"
+#include "FlowPreloadManifest.h"
 #include "FlowSave.h"
 #include "FlowSettings.h"
 #include "Nodes/Graph/FlowNode_SubGraph.h"
 
 #include "Engine/GameInstance.h"
+#include "Engine/Level.h"
 #include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
 #include "Logging/MessageLog.h"
 #include "Misc/Paths.h"
 #include "UObject/UObjectHash.h"
+#include "UObject/UnrealType.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowSubsystem)
 
@@ -22,6 +26,28 @@ FNativeFlowAssetEvent UFlowSubsystem::OnInstancedTemplateAdded;
 FNativeFlowAssetEvent UFlowSubsystem::OnInstancedTemplateRemoved;
 #endif
 
+#if WITH_EDITOR
+TSet<FSoftObjectPath> UFlowSubsystem::RecordedTemplateUsage;
+#endif
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice DumpFlowMemoryFootprintCommand(
+	TEXT("Flow.DumpMemoryFootprint"),
+	TEXT("Logs memory allocated by Flow templates and their instances. Optional argument: number of the largest instances to list, 10 by default."),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+		const UFlowSubsystem* FlowSubsystem = GameInstance ? GameInstance->GetSubsystem<UFlowSubsystem>() : nullptr;
+		if (FlowSubsystem == nullptr)
+		{
+			Ar.Log(TEXT("Flow Subsystem doesn't exist in this world"));
+			return;
+		}
+
+		FlowSubsystem->DumpMemoryFootprint(Ar, Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 10);
+	}));
+#endif
+
 #define LOCTEXT_NAMESPACE "FlowSubsystem"
 
 UFlowSubsystem::UFlowSubsystem()
@@ -50,11 +76,44 @@ bool UFlowSubsystem::ShouldCreateSubsystem(UObject* Outer) const
 
 void UFlowSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
+	FWorldDelegates::OnWorldCleanup.AddUObject(this, &UFlowSubsystem::OnWorldCleanup);
+
+	if (UFlowSettings::Get()->bBulkUnregisterOnLevelRemoval)
+	{
+		FWorldDelegates::PreLevelRemovedFromWorld.AddUObject(this, &UFlowSubsystem::OnPreLevelRemovedFromWorld);
+	}
+
+	if (!UFlowSettings::Get()->DefaultPreloadManifest.IsNull())
+	{
+		PreloadManifest(UFlowSettings::Get()->DefaultPreloadManifest.LoadSynchronous());
+	}
 }
 
 void UFlowSubsystem::Deinitialize()
 {
+	FWorldDelegates::OnWorldCleanup.RemoveAll(this);
+	FWorldDelegates::PreLevelRemovedFromWorld.RemoveAll(this);
+
 	AbortActiveFlows();
+
+	TArray<TObjectKey<UWorld>> PreloadedWorlds;
+	PreloadRequests.GetKeys(PreloadedWorlds);
+	for (const TObjectKey<UWorld>& PreloadedWorld : PreloadedWorlds)
+	{
+		ReleasePreloadRequests(PreloadedWorld);
+	}
+
+	for (const TPair<TObjectKey<UWorld>, FFlowWorldPartition>& WorldPartition : WorldPartitions)
+	{
+		for (const TPair<TWeakObjectPtr<UFlowComponent>, TPair<TWeakObjectPtr<USceneComponent>, FDelegateHandle>>& TrackedRoot : WorldPartition.Value.SpatiallyTrackedRoots)
+		{
+			if (USceneComponent* RootComponent = TrackedRoot.Value.Key.Get())
+			{
+				RootComponent->TransformUpdated.Remove(TrackedRoot.Value.Value);
+			}
+		}
+	}
+	WorldPartitions.Empty();
 }
 
 void UFlowSubsystem::AbortActiveFlows()
@@ -74,6 +133,10 @@ void UFlowSubsystem::AbortActiveFlows()
 	InstancedSubFlows.Empty();
 
 	RootInstances.Empty();
+	for (TPair<TObjectKey<UWorld>, FFlowWorldPartition>& WorldPartition : WorldPartitions)
+	{
+		WorldPartition.Value.RootInstances.Empty();
+	}
 }
 
 void UFlowSubsystem::StartRootFlow(UObject* Owner, UFlowAsset* FlowAsset, const bool bAllowMultipleInstances /* = true */, const FGuid& StartingNodeGuid /* = FGuid() */)
@@ -116,12 +179,97 @@ UFlowAsset* UFlowSubsystem::CreateRootFlow(UObject* Owner, UFlowAsset* FlowAsset
 	UFlowAsset* NewFlow = CreateFlowInstance(Owner, FlowAsset, NewInstanceName);
 	if (NewFlow)
 	{
-		RootInstances.Add(NewFlow, Owner);
+		AddRootInstance(NewFlow, Owner);
 	}
 
 	return NewFlow;
 }
 
+void UFlowSubsystem::StartRootFlows(const TArray<UObject*>& Owners, UFlowAsset* FlowAsset, const bool bAllowMultipleInstances /* = true */)
+{
+	if (FlowAsset == nullptr)
+	{
+#if WITH_EDITOR
+		FMessageLog("PIE").Error(LOCTEXT("StartRootFlowsNullAsset", "Attempted to start Root Flows with a null asset."));
+#endif
+		return;
+	}
+
+	TArray<UFlowAsset*> NewFlows;
+	CreateRootFlows(Owners, FlowAsset, bAllowMultipleInstances, NewFlows);
+
+	for (UFlowAsset* NewFlow : NewFlows)
+	{
+		NewFlow->StartFlow();
+	}
+}
+
+void UFlowSubsystem::CreateRootFlows(TConstArrayView<UObject*> Owners, UFlowAsset* FlowAsset, const bool bAllowMultipleInstances, TArray<UFlowAsset*>& OutNewFlows)
+{
+	if (FlowAsset == nullptr || Owners.IsEmpty())
+	{
+		return;
+	}
+
+	if (!bAllowMultipleInstances && InstancedTemplates.Contains(FlowAsset))
+	{
+		UE_LOG(LogFlow, Warning, TEXT("Attempted to start Root Flows, although there can be only a single instance. Flow Asset: %s."), *FlowAsset->GetName());
+		return;
+	}
+
+	// single pass over existing root instances, instead of one per owner
+	TSet<const UObject*> OwnersWithInstance;
+	for (const TPair<UFlowAsset*, TWeakObjectPtr<UObject>>& RootInstance : ObjectPtrDecay(RootInstances))
+	{
+		if (RootInstance.Key && RootInstance.Key->GetTemplateAsset() == FlowAsset)
+		{
+			OwnersWithInstance.Add(RootInstance.Value.Get());
+		}
+	}
+
+	const int32 MaxNewFlows = bAllowMultipleInstances ? Owners.Num() : 1;
+	OutNewFlows.Reserve(OutNewFlows.Num() + MaxNewFlows);
+	RootInstances.Reserve(RootInstances.Num() + MaxNewFlows);
+
+	const FString BaseInstanceName = FPaths::GetBaseFilename(FlowAsset->GetPathName());
+	bool bTemplatePrepared = false;
+
+	for (UObject* Owner : Owners)
+	{
+		if (Owner == nullptr)
+		{
+			continue;
+		}
+
+		bool bAlreadyInSet = false;
+		OwnersWithInstance.Add(Owner, &bAlreadyInSet);
+		if (bAlreadyInSet)
+		{
+			UE_LOG(LogFlow, Warning, TEXT("Attempted to start Root Flow for the same Owner again. Owner: %s. Flow Asset: %s."), *Owner->GetName(), *FlowAsset->GetName());
+			continue;
+		}
+
+		// template is registered as instanced only once there's a valid owner to instantiate it for
+		if (!bTemplatePrepared)
+		{
+			FlowAsset->ReserveInstances(MaxNewFlows);
+			PrepareTemplateForInstancing(FlowAsset);
+			bTemplatePrepared = true;
+		}
+
+		if (UFlowAsset* NewFlow = InstantiatePreparedTemplate(Owner, FlowAsset, BaseInstanceName, FString()))
+		{
+			AddRootInstance(NewFlow, Owner);
+			OutNewFlows.Emplace(NewFlow);
+
+			if (!bAllowMultipleInstances)
+			{
+				break;
+			}
+		}
+	}
+}
+
 void UFlowSubsystem::FinishRootFlow(UObject* Owner, UFlowAsset* TemplateAsset, const EFlowFinishPolicy FinishPolicy)
 {
 	UFlowAsset* InstanceToFinish = nullptr;
@@ -137,7 +285,7 @@ void UFlowSubsystem::FinishRootFlow(UObject* Owner, UFlowAsset* TemplateAsset, c
 
 	if (InstanceToFinish)
 	{
-		RootInstances.Remove(InstanceToFinish);
+		RemoveRootInstance(InstanceToFinish);
 		InstanceToFinish->FinishFlow(FinishPolicy);
 	}
 }
@@ -156,7 +304,7 @@ void UFlowSubsystem::FinishAllRootFlows(UObject* Owner, const EFlowFinishPolicy
 
 	for (UFlowAsset* InstanceToFinish : InstancesToFinish)
 	{
-		RootInstances.Remove(InstanceToFinish);
+		RemoveRootInstance(InstanceToFinish);
 		InstanceToFinish->FinishFlow(FinishPolicy);
 	}
 }
@@ -222,20 +370,32 @@ UFlowAsset* UFlowSubsystem::CreateFlowInstance(const TWeakObjectPtr<UObject> Own
 		return nullptr;
 	}
 
+	PrepareTemplateForInstancing(LoadedFlowAsset);
+
+	// it won't be empty, if we're restoring Flow Asset instance from the SaveGame
+	const FString BaseInstanceName = NewInstanceName.IsEmpty() ? FPaths::GetBaseFilename(LoadedFlowAsset->GetPathName()) : FString();
+	return InstantiatePreparedTemplate(Owner, LoadedFlowAsset, BaseInstanceName, MoveTemp(NewInstanceName));
+}
+
+void UFlowSubsystem::PrepareTemplateForInstancing(UFlowAsset* LoadedFlowAsset)
+{
 	AddInstancedTemplate(LoadedFlowAsset);
 
 #if WITH_EDITOR
 	if (GetWorld()->WorldType != EWorldType::Game)
 	{
 		// Fix connections - even in packaged game if assets haven't been re-saved in the editor after changing node's definition
-		LoadedFlowAsset->HarvestNodeConnections();
+		// Skipped if no pins changed since the last harvest
+		LoadedFlowAsset->HarvestDirtyNodeConnections();
 	}
 #endif
+}
 
-	// it won't be empty, if we're restoring Flow Asset instance from the SaveGame
+UFlowAsset* UFlowSubsystem::InstantiatePreparedTemplate(const TWeakObjectPtr<UObject> Owner, UFlowAsset* LoadedFlowAsset, const FString& BaseInstanceName, FString NewInstanceName)
+{
 	if (NewInstanceName.IsEmpty())
 	{
-		NewInstanceName = MakeUniqueObjectName(this, UFlowAsset::StaticClass(), *FPaths::GetBaseFilename(LoadedFlowAsset->GetPathName())).ToString();
+		NewInstanceName = MakeUniqueObjectName(this, UFlowAsset::StaticClass(), *BaseInstanceName).ToString();
 	}
 
 	UFlowAsset* NewInstance = NewObject<UFlowAsset>(this, LoadedFlowAsset->GetClass(), *NewInstanceName, RF_Transient, LoadedFlowAsset, false, nullptr);
@@ -255,6 +415,8 @@ void UFlowSubsystem::AddInstancedTemplate(UFlowAsset* Template)
 #if WITH_EDITOR
 		Template->RuntimeLog = MakeShareable(new FFlowMessageLog());
 		OnInstancedTemplateAdded.ExecuteIfBound(Template);
+
+		RecordedTemplateUsage.Add(FSoftObjectPath(Template));
 #endif
 	}
 }
@@ -334,35 +496,48 @@ void UFlowSubsystem::OnGameSaved(UFlowSaveGame* SaveGame)
 		}
 	}
 
+	// save only data of the current world + global Flow Graph instances, matching data cleared above
+	const FFlowWorldPartition* WorldPartitionsToSave[] = {FindWorldPartition(GetWorld()), FindWorldPartition(nullptr)};
+
 	// save Flow Graphs
-	for (const TPair<UFlowAsset*, TWeakObjectPtr<UObject>>& RootInstance : ObjectPtrDecay(RootInstances))
+	for (int32 Index = 0; Index < UE_ARRAY_COUNT(WorldPartitionsToSave); Index++)
 	{
-		if (RootInstance.Key && RootInstance.Value.IsValid())
+		const FFlowWorldPartition* WorldPartition = WorldPartitionsToSave[Index];
+
+		// without a world both entries point to the global partition, it must not be saved twice
+		if (WorldPartition == nullptr || (Index > 0 && WorldPartition == WorldPartitionsToSave[0]))
 		{
-			if (UFlowComponent* FlowComponent = Cast<UFlowComponent>(RootInstance.Value))
-			{
-				FlowComponent->SaveRootFlow(SaveGame->FlowInstances);
-			}
-			else
+			continue;
+		}
+
+		for (const TWeakObjectPtr<UFlowAsset>& WeakRootInstance : WorldPartition->RootInstances)
+		{
+			UFlowAsset* RootInstance = WeakRootInstance.Get();
+			const TWeakObjectPtr<UObject>* Owner = RootInstance ? RootInstances.Find(RootInstance) : nullptr;
+			if (Owner && Owner->IsValid())
 			{
-				RootInstance.Key->SaveInstance(SaveGame->FlowInstances);
+				if (UFlowComponent* FlowComponent = Cast<UFlowComponent>(Owner->Get()))
+				{
+					FlowComponent->SaveRootFlow(SaveGame->FlowInstances);
+				}
+				else
+				{
+					RootInstance->SaveInstance(SaveGame->FlowInstances);
+				}
 			}
 		}
 	}
 
-	// save Flow Components
+	// save Flow Components registered in the current world
+	if (const FFlowWorldPartition* WorldPartition = WorldPartitionsToSave[0])
 	{
-		// retrieve all registered components
-		TArray<TWeakObjectPtr<UFlowComponent>> ComponentsArray;
-		FlowComponentRegistry.GenerateValueArray(ComponentsArray);
-
-		// ensure uniqueness of entries
-		const TSet<TWeakObjectPtr<UFlowComponent>> RegisteredComponents = TSet<TWeakObjectPtr<UFlowComponent>>(ComponentsArray);
-
-		// write archives to SaveGame
-		for (const TWeakObjectPtr<UFlowComponent> RegisteredComponent : RegisteredComponents)
+		for (const TWeakObjectPtr<UFlowComponent>& RegisteredComponent : WorldPartition->Components)
 		{
-			SaveGame->FlowComponents.Emplace(RegisteredComponent->SaveInstance());
+			// components without Identity Tags aren't present in the registry
+			if (RegisteredComponent.IsValid() && RegisteredComponent->IdentityTags.Num() > 0)
+			{
+				SaveGame->FlowComponents.Emplace(RegisteredComponent->SaveInstance());
+			}
 		}
 	}
 }
@@ -421,232 +596,1016 @@ void UFlowSubsystem::LoadSubFlow(UFlowNode_SubGraph* SubGraphNode, const FString
 	}
 }
 
-void UFlowSubsystem::RegisterComponent(UFlowComponent* Component)
+void UFlowSubsystem::PreloadManifest(const UFlowPreloadManifest* Manifest, const UObject* WorldContextObject /* = nullptr */)
 {
-	for (const FGameplayTag& Tag : Component->IdentityTags)
+	if (Manifest == nullptr)
 	{
-		if (Tag.IsValid())
-		{
-			FlowComponentRegistry.Emplace(Tag, Component);
-		}
+		return;
 	}
 
-	OnComponentRegistered.Broadcast(Component);
-}
-
-void UFlowSubsystem::OnIdentityTagAdded(UFlowComponent* Component, const FGameplayTag& AddedTag)
-{
-	FlowComponentRegistry.Emplace(AddedTag, Component);
-
-	// broadcast OnComponentRegistered only if this component wasn't present in the registry previously
-	if (Component->IdentityTags.Num() > 1)
+	TArray<FSoftObjectPath> Paths;
+	Paths.Reserve(Manifest->Templates.Num());
+	for (const TSoftObjectPtr<UFlowAsset>& Template : Manifest->Templates)
 	{
-		OnComponentTagAdded.Broadcast(Component, FGameplayTagContainer(AddedTag));
+		Paths.Emplace(Template.ToSoftObjectPath());
 	}
-	else
+
+	UE_LOG(LogFlow, Log, TEXT("Preloading %d templates listed in %s"), Paths.Num(), *Manifest->GetName());
+
+	const TObjectKey<UWorld> World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+
+	// nothing new to load and no earlier request in progress
+	if (!RequestPreload(World, MoveTemp(Paths), Manifest->bPreloadSubGraphs, Manifest->bPreloadNodeContent) && PreloadRequests.FindOrAdd(World).PendingRequests == 0)
 	{
-		OnComponentRegistered.Broadcast(Component);
+		OnPreloadCompleted.Broadcast();
 	}
 }
 
-void UFlowSubsystem::OnIdentityTagsAdded(UFlowComponent* Component, const FGameplayTagContainer& AddedTags)
+void UFlowSubsystem::ReleasePreloadedContent(const UObject* WorldContextObject /* = nullptr */)
 {
-	for (const FGameplayTag& Tag : AddedTags)
-	{
-		FlowComponentRegistry.Emplace(Tag, Component);
-	}
-
-	// broadcast OnComponentRegistered only if this component wasn't present in the registry previously
-	if (Component->IdentityTags.Num() > AddedTags.Num())
-	{
-		OnComponentTagAdded.Broadcast(Component, AddedTags);
-	}
-	else
-	{
-		OnComponentRegistered.Broadcast(Component);
-	}
+	ReleasePreloadRequests(WorldContextObject ? WorldContextObject->GetWorld() : nullptr);
 }
 
-void UFlowSubsystem::UnregisterComponent(UFlowComponent* Component)
+bool UFlowSubsystem::IsPreloading() const
 {
-	for (const FGameplayTag& Tag : Component->IdentityTags)
+	for (const TPair<TObjectKey<UWorld>, FFlowPreloadRequests>& Requests : PreloadRequests)
 	{
-		if (Tag.IsValid())
+		if (Requests.Value.PendingRequests > 0)
 		{
-			FlowComponentRegistry.Remove(Tag, Component);
+			return true;
 		}
 	}
 
-	OnComponentUnregistered.Broadcast(Component);
-}
-
-void UFlowSubsystem::OnIdentityTagRemoved(UFlowComponent* Component, const FGameplayTag& RemovedTag)
-{
-	FlowComponentRegistry.Remove(RemovedTag, Component);
-
-	// broadcast OnComponentUnregistered only if this component isn't present in the registry anymore
-	if (Component->IdentityTags.Num() > 0)
-	{
-		OnComponentTagRemoved.Broadcast(Component, FGameplayTagContainer(RemovedTag));
-	}
-	else
-	{
-		OnComponentUnregistered.Broadcast(Component);
-	}
+	return false;
 }
 
-void UFlowSubsystem::OnIdentityTagsRemoved(UFlowComponent* Component, const FGameplayTagContainer& RemovedTags)
+void UFlowSubsystem::ReleasePreloadRequests(const TObjectKey<UWorld> World)
 {
-	for (const FGameplayTag& Tag : RemovedTags)
+	FFlowPreloadRequests Requests;
+	if (!PreloadRequests.RemoveAndCopyValue(World, Requests))
 	{
-		FlowComponentRegistry.Remove(Tag, Component);
+		return;
 	}
 
-	// broadcast OnComponentUnregistered only if this component isn't present in the registry anymore
-	if (Component->IdentityTags.Num() > 0)
-	{
-		OnComponentTagRemoved.Broadcast(Component, RemovedTags);
-	}
-	else
+	for (const TSharedPtr<FStreamableHandle>& Handle : Requests.Handles)
 	{
-		OnComponentUnregistered.Broadcast(Component);
+		if (Handle.IsValid())
+		{
+			// cancelled handles don't call their completion delegate
+			Handle->CancelHandle();
+		}
 	}
 }
 
-TSet<UFlowComponent*> UFlowSubsystem::GetFlowComponentsByTag(const FGameplayTag Tag, const TSubclassOf<UFlowComponent> ComponentClass, const bool bExactMatch) const
+bool UFlowSubsystem::RequestPreload(const TObjectKey<UWorld> World, TArray<FSoftObjectPath> Paths, const bool bPreloadSubGraphs, const bool bPreloadNodeContent)
 {
-	TArray<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-	FindComponents(Tag, bExactMatch, FoundComponents);
+	FFlowPreloadRequests& Requests = PreloadRequests.FindOrAdd(World);
 
-	TSet<UFlowComponent*> Result;
-	for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+	Paths.RemoveAll([&Requests](const FSoftObjectPath& Path)
 	{
-		if (Component.IsValid() && Component->GetClass()->IsChildOf(ComponentClass))
+		if (Path.IsNull())
 		{
-			Result.Emplace(Component.Get());
+			return true;
 		}
+
+		bool bAlreadyRequested = false;
+		Requests.Paths.Add(Path, &bAlreadyRequested);
+		return bAlreadyRequested;
+	});
+
+	if (Paths.Num() == 0)
+	{
+		return false;
 	}
 
-	return Result;
-}
+	// counted before the request, as the delegate is called immediately if everything is loaded already
+	Requests.PendingRequests++;
 
-TSet<UFlowComponent*> UFlowSubsystem::GetFlowComponentsByTags(const FGameplayTagContainer Tags, const EGameplayContainerMatchType MatchType, const TSubclassOf<UFlowComponent> ComponentClass, const bool bExactMatch) const
-{
-	TSet<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-	FindComponents(Tags, MatchType, bExactMatch, FoundComponents);
+	const FStreamableDelegate Delegate = FStreamableDelegate::CreateUObject(this, &UFlowSubsystem::OnPreloadBatchLoaded, Paths, World, bPreloadSubGraphs, bPreloadNodeContent);
+	const TSharedPtr<FStreamableHandle> Handle = PreloadStreamableManager.RequestAsyncLoad(MoveTemp(Paths), Delegate);
 
-	TSet<UFlowComponent*> Result;
-	for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+	// delegate might have already run and added requests, so the map could be reallocated
+	if (Handle.IsValid())
 	{
-		if (Component.IsValid() && Component->GetClass()->IsChildOf(ComponentClass))
+		if (FFlowPreloadRequests* CurrentRequests = PreloadRequests.Find(World))
 		{
-			Result.Emplace(Component.Get());
+			CurrentRequests->Handles.Emplace(Handle);
 		}
 	}
 
-	return Result;
+	return true;
 }
 
-TSet<AActor*> UFlowSubsystem::GetFlowActorsByTag(const FGameplayTag Tag, const TSubclassOf<AActor> ActorClass, const bool bExactMatch) const
+void UFlowSubsystem::OnPreloadBatchLoaded(TArray<FSoftObjectPath> Paths, const TObjectKey<UWorld> World, const bool bPreloadSubGraphs, const bool bPreloadNodeContent)
 {
-	TArray<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-	FindComponents(Tag, bExactMatch, FoundComponents);
-
-	TSet<AActor*> Result;
-	for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+	if (bPreloadSubGraphs || bPreloadNodeContent)
 	{
-		if (Component.IsValid() && Component->GetOwner()->GetClass()->IsChildOf(ActorClass))
+		TArray<FSoftObjectPath> NextPaths;
+		for (const FSoftObjectPath& Path : Paths)
 		{
-			Result.Emplace(Component->GetOwner());
+			if (const UFlowAsset* FlowAsset = Cast<UFlowAsset>(Path.ResolveObject()))
+			{
+				GatherNodeReferences(FlowAsset, bPreloadSubGraphs, bPreloadNodeContent, NextPaths);
+			}
 		}
+
+		// next wave is requested before this one is marked as finished, so completion isn't reported in between
+		RequestPreload(World, MoveTemp(NextPaths), bPreloadSubGraphs, bPreloadNodeContent);
 	}
 
-	return Result;
+	FFlowPreloadRequests* Requests = PreloadRequests.Find(World);
+	if (Requests && Requests->PendingRequests > 0 && --Requests->PendingRequests == 0)
+	{
+		UE_LOG(LogFlow, Log, TEXT("Preloading finished, %d assets requested"), Requests->Paths.Num());
+		OnPreloadCompleted.Broadcast();
+	}
 }
 
-TSet<AActor*> UFlowSubsystem::GetFlowActorsByTags(const FGameplayTagContainer Tags, const EGameplayContainerMatchType MatchType, const TSubclassOf<AActor> ActorClass, const bool bExactMatch) const
+void UFlowSubsystem::GatherNodeReferences(const UFlowAsset* FlowAsset, const bool bPreloadSubGraphs, const bool bPreloadNodeContent, TArray<FSoftObjectPath>& OutPaths)
 {
-	TSet<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-	FindComponents(Tags, MatchType, bExactMatch, FoundComponents);
-
-	TSet<AActor*> Result;
-	for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+	// nodes are outered to the asset, and add-ons to their nodes
+	ForEachObjectWithOuter(FlowAsset, [&](UObject* Object)
 	{
-		if (Component.IsValid() && Component->GetOwner()->GetClass()->IsChildOf(ActorClass))
+		if (!Object->IsA<UFlowNodeBase>())
 		{
-			Result.Emplace(Component->GetOwner());
+			return;
 		}
-	}
 
-	return Result;
+		// recurses into structs and containers, so references held by arrays or nested structs are found too
+		for (TPropertyValueIterator<FSoftObjectProperty> PropertyIt(Object->GetClass(), Object); PropertyIt; ++PropertyIt)
+		{
+			const FSoftObjectProperty* Property = PropertyIt.Key();
+			const FSoftObjectPath& Path = Property->GetPropertyValue(PropertyIt.Value()).ToSoftObjectPath();
+			if (Path.IsNull())
+			{
+				continue;
+			}
+
+			const bool bSubGraph = Property->PropertyClass && Property->PropertyClass->IsChildOf(UFlowAsset::StaticClass());
+			if (bSubGraph ? bPreloadSubGraphs : bPreloadNodeContent)
+			{
+				OutPaths.Emplace(Path);
+			}
+		}
+	}, true);
 }
 
-TMap<AActor*, UFlowComponent*> UFlowSubsystem::GetFlowActorsAndComponentsByTag(const FGameplayTag Tag, const TSubclassOf<AActor> ActorClass, const bool bExactMatch) const
+#if !UE_BUILD_SHIPPING
+void UFlowSubsystem::GatherMemoryFootprint(TArray<FFlowTemplateMemoryReport>& OutReports) const
 {
-	TArray<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-	FindComponents(Tag, bExactMatch, FoundComponents);
-
-	TMap<AActor*, UFlowComponent*> Result;
-	for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+	TMap<FString, SIZE_T> SaveBuffers;
+	if (LoadedSaveGame)
 	{
-		if (Component.IsValid() && Component->GetOwner()->GetClass()->IsChildOf(ActorClass))
+		for (const FFlowAssetSaveData& AssetRecord : LoadedSaveGame->FlowInstances)
 		{
-			Result.Emplace(Component->GetOwner(), Component.Get());
+			SIZE_T Bytes = AssetRecord.WorldName.GetAllocatedSize() + AssetRecord.InstanceName.GetAllocatedSize()
+				+ AssetRecord.AssetData.GetAllocatedSize() + AssetRecord.NodeRecords.GetAllocatedSize();
+			for (const FFlowNodeSaveData& NodeRecord : AssetRecord.NodeRecords)
+			{
+				Bytes += NodeRecord.NodeData.GetAllocatedSize();
+			}
+			SaveBuffers.FindOrAdd(AssetRecord.InstanceName) += Bytes;
 		}
 	}
 
-	return Result;
-}
-
-TMap<AActor*, UFlowComponent*> UFlowSubsystem::GetFlowActorsAndComponentsByTags(const FGameplayTagContainer Tags, const EGameplayContainerMatchType MatchType, const TSubclassOf<AActor> ActorClass, const bool bExactMatch) const
-{
-	TSet<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-	FindComponents(Tags, MatchType, bExactMatch, FoundComponents);
-
-	TMap<AActor*, UFlowComponent*> Result;
-	for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+	OutReports.Reserve(OutReports.Num() + InstancedTemplates.Num());
+	for (const UFlowAsset* Template : ObjectPtrDecay(InstancedTemplates))
 	{
-		if (Component.IsValid() && Component->GetOwner()->GetClass()->IsChildOf(ActorClass))
+		if (Template == nullptr)
 		{
-			Result.Emplace(Component->GetOwner(), Component.Get());
+			continue;
 		}
-	}
 
-	return Result;
-}
+		FFlowTemplateMemoryReport& Report = OutReports.AddDefaulted_GetRef();
+		Report.TemplatePath = Template->GetPathName();
+		Template->GetMemoryFootprint(Report.TemplateFootprint);
 
-void UFlowSubsystem::FindComponents(const FGameplayTag& Tag, const bool bExactMatch, TArray<TWeakObjectPtr<UFlowComponent>>& OutComponents) const
-{
-	if (bExactMatch)
-	{
-		FlowComponentRegistry.MultiFind(Tag, OutComponents);
-	}
-	else
-	{
-		for (TMultiMap<FGameplayTag, TWeakObjectPtr<UFlowComponent>>::TConstIterator It(FlowComponentRegistry); It; ++It)
+		Report.Instances.Reserve(Template->ActiveInstances.Num());
+		for (const UFlowAsset* Instance : ObjectPtrDecay(Template->ActiveInstances))
 		{
-			if (It.Key().MatchesTag(Tag))
+			if (Instance == nullptr)
 			{
-				OutComponents.Emplace(It.Value());
+				continue;
 			}
+
+			FFlowInstanceMemoryReport& InstanceReport = Report.Instances.AddDefaulted_GetRef();
+			InstanceReport.InstanceName = Instance->GetName();
+			Instance->GetMemoryFootprint(InstanceReport.Footprint);
+			InstanceReport.Footprint.SaveBuffers = SaveBuffers.FindRef(InstanceReport.InstanceName);
+
+			Report.InstancesFootprint += InstanceReport.Footprint;
 		}
+
+		Report.Instances.Sort([](const FFlowInstanceMemoryReport& A, const FFlowInstanceMemoryReport& B)
+		{
+			return A.Footprint.GetTotal() > B.Footprint.GetTotal();
+		});
 	}
+
+	OutReports.Sort([](const FFlowTemplateMemoryReport& A, const FFlowTemplateMemoryReport& B)
+	{
+		return A.GetTotal() > B.GetTotal();
+	});
 }
 
-void UFlowSubsystem::FindComponents(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch, TSet<TWeakObjectPtr<UFlowComponent>>& OutComponents) const
+void UFlowSubsystem::DumpMemoryFootprint(FOutputDevice& Ar, const int32 NumTopOffenders /* = 10 */) const
 {
-	if (MatchType == EGameplayContainerMatchType::Any)
+	TArray<FFlowTemplateMemoryReport> Reports;
+	GatherMemoryFootprint(Reports);
+
+	FFlowMemoryFootprint Total;
+	TArray<const FFlowInstanceMemoryReport*> AllInstances;
+
+	Ar.Logf(TEXT("Flow memory footprint of %d instanced templates"), Reports.Num());
+	for (const FFlowTemplateMemoryReport& Report : Reports)
 	{
-		for (const FGameplayTag& Tag : Tags)
+		Ar.Logf(TEXT("%s: %s in %d instances"), *Report.TemplatePath, *FFlowMemoryFootprint::FormatBytes(Report.GetTotal()), Report.Instances.Num());
+		Ar.Logf(TEXT("    Template: %s"), *Report.TemplateFootprint.ToString());
+		Ar.Logf(TEXT("    Instances: %s"), *Report.InstancesFootprint.ToString());
+
+		Total += Report.TemplateFootprint;
+		Total += Report.InstancesFootprint;
+
+		for (const FFlowInstanceMemoryReport& Instance : Report.Instances)
 		{
-			TArray<TWeakObjectPtr<UFlowComponent>> ComponentsPerTag;
-			FindComponents(Tag, bExactMatch, ComponentsPerTag);
-			OutComponents.Append(ComponentsPerTag);
+			AllInstances.Emplace(&Instance);
 		}
 	}
-	else // EGameplayContainerMatchType::All
+
+	// sorting array of pointers passes dereferenced elements to the predicate
+	AllInstances.Sort([](const FFlowInstanceMemoryReport& A, const FFlowInstanceMemoryReport& B)
 	{
-		TSet<TWeakObjectPtr<UFlowComponent>> ComponentsWithAnyTag;
+		return A.Footprint.GetTotal() > B.Footprint.GetTotal();
+	});
+
+	const int32 NumListed = FMath::Min(FMath::Max(NumTopOffenders, 0), AllInstances.Num());
+	Ar.Logf(TEXT("Largest %d of %d instances"), NumListed, AllInstances.Num());
+	for (int32 i = 0; i < NumListed; i++)
+	{
+		Ar.Logf(TEXT("    %s: %s"), *AllInstances[i]->InstanceName, *AllInstances[i]->Footprint.ToString());
+	}
+
+	Ar.Logf(TEXT("Flow memory footprint: %s"), *Total.ToString());
+}
+#endif
+
+FFlowWorldPartition* UFlowSubsystem::FindWorldPartition(const UWorld* World)
+{
+	return WorldPartitions.Find(World);
+}
+
+const FFlowWorldPartition* UFlowSubsystem::FindWorldPartition(const UWorld* World) const
+{
+	return WorldPartitions.Find(World);
+}
+
+FFlowWorldPartition* UFlowSubsystem::FindOrAddWorldPartition(const UWorld* World)
+{
+	if (FFlowWorldPartition* WorldPartition = WorldPartitions.Find(World))
+	{
+		return WorldPartition;
+	}
+
+	if (World && RemovedWorld == TObjectKey<UWorld>(World))
+	{
+		return nullptr;
+	}
+
+	FFlowWorldPartition& NewPartition = WorldPartitions.Add(World);
+	if (World && UFlowSettings::Get()->bEnableSpatialComponentQueries)
+	{
+		NewPartition.SpatialGrid = MakeUnique<FFlowSpatialGrid>(UFlowSettings::Get()->SpatialQueryCellSize);
+	}
+	return &NewPartition;
+}
+
+void UFlowSubsystem::RemoveFromComponentRegistry(const TArray<FGameplayTag>& Tags, const TSet<TWeakObjectPtr<UFlowComponent>>& Components)
+{
+	for (const FGameplayTag& Tag : Tags)
+	{
+		for (TMultiMap<FGameplayTag, TWeakObjectPtr<UFlowComponent>>::TKeyIterator It(FlowComponentRegistry, Tag); It; ++It)
+		{
+			if (Components.Contains(It.Value()))
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+}
+
+void UFlowSubsystem::OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	RemoveWorldPartition(World);
+
+	// content preloaded without a world is kept, as it's shared by all worlds
+	if (World)
+	{
+		ReleasePreloadRequests(World);
+	}
+}
+
+void UFlowSubsystem::RemoveWorldPartition(const UWorld* World)
+{
+	FFlowWorldPartition* FoundPartition = World ? WorldPartitions.Find(World) : nullptr;
+	if (FoundPartition == nullptr)
+	{
+		return;
+	}
+
+	// partition is dropped before anything is finished, so the rest of the removal works on its moved data
+	const FFlowWorldPartition WorldPartition = MoveTemp(*FoundPartition);
+	WorldPartitions.Remove(World);
+
+	// finishing flows below might register components or start root flows, these aren't added to the removed world
+	TGuardValue<TObjectKey<UWorld>> RemovedWorldGuard(RemovedWorld, World);
+
+	for (const TPair<TWeakObjectPtr<UFlowComponent>, TPair<TWeakObjectPtr<USceneComponent>, FDelegateHandle>>& TrackedRoot : WorldPartition.SpatiallyTrackedRoots)
+	{
+		if (USceneComponent* RootComponent = TrackedRoot.Value.Key.Get())
+		{
+			RootComponent->TransformUpdated.Remove(TrackedRoot.Value.Value);
+		}
+	}
+
+	// partition knows tags of its components, so only entries of these tags are visited in the shared registry
+	if (WorldPartition.Components.Num() > 0)
+	{
+		TArray<FGameplayTag> WorldTags;
+		WorldPartition.ClassPartitionedRegistry.GetKeys(WorldTags);
+		RemoveFromComponentRegistry(WorldTags, WorldPartition.Components);
+	}
+
+	for (const TWeakObjectPtr<UFlowAsset>& RootInstance : WorldPartition.RootInstances)
+	{
+		if (UFlowAsset* InstanceToFinish = RootInstance.Get())
+		{
+			RootInstances.Remove(InstanceToFinish);
+			InstanceToFinish->FinishFlow(EFlowFinishPolicy::Keep);
+		}
+	}
+}
+
+void UFlowSubsystem::OnPreLevelRemovedFromWorld(ULevel* Level, UWorld* World)
+{
+	// null level means that all levels are being removed, this is handled by the world cleanup
+	if (Level && World && World->GetGameInstance() == GetGameInstance())
+	{
+		UnregisterLevelComponents(Level);
+	}
+}
+
+void UFlowSubsystem::UnregisterLevelComponents(ULevel* Level)
+{
+	FFlowWorldPartition* WorldPartition = Level ? FindWorldPartition(Level->GetWorld()) : nullptr;
+	TSet<TWeakObjectPtr<UFlowComponent>> LevelComponents;
+	if (WorldPartition == nullptr || !WorldPartition->ComponentsByLevel.RemoveAndCopyValue(Level, LevelComponents))
+	{
+		return;
+	}
+
+	// finish root flows of the whole level in a single pass over root instances
+	TArray<UFlowAsset*> InstancesToFinish;
+	for (const TPair<UFlowAsset*, TWeakObjectPtr<UObject>>& RootInstance : ObjectPtrDecay(RootInstances))
+	{
+		if (RootInstance.Key && RootInstance.Value.IsValid() && RootInstance.Value->IsIn(Level))
+		{
+			InstancesToFinish.Emplace(RootInstance.Key);
+		}
+	}
+
+	for (UFlowAsset* InstanceToFinish : InstancesToFinish)
+	{
+		RemoveRootInstance(InstanceToFinish);
+		InstanceToFinish->FinishFlow(EFlowFinishPolicy::Keep);
+	}
+
+	// single pass over the world partition, the shared registry is visited only for tags of removed components
+	TArray<FGameplayTag> LevelTags;
+	for (TMap<FGameplayTag, TArray<FFlowComponentClassPartition>>::TIterator TagIt(WorldPartition->ClassPartitionedRegistry); TagIt; ++TagIt)
+	{
+		TArray<FFlowComponentClassPartition>& Partitions = TagIt.Value();
+		for (int32 Index = Partitions.Num() - 1; Index >= 0; Index--)
+		{
+			const int32 RemovedCount = Partitions[Index].Components.RemoveAllSwap([&LevelComponents](const TWeakObjectPtr<UFlowComponent>& Component)
+			{
+				return LevelComponents.Contains(Component);
+			});
+
+			if (RemovedCount > 0)
+			{
+				LevelTags.AddUnique(TagIt.Key());
+			}
+
+			if (Partitions[Index].Components.Num() == 0)
+			{
+				Partitions.RemoveAtSwap(Index);
+			}
+		}
+
+		if (Partitions.Num() == 0)
+		{
+			TagIt.RemoveCurrent();
+		}
+	}
+
+	RemoveFromComponentRegistry(LevelTags, LevelComponents);
+
+	TArray<UFlowComponent*> UnregisteredComponents;
+	UnregisteredComponents.Reserve(LevelComponents.Num());
+
+	for (const TWeakObjectPtr<UFlowComponent>& Component : LevelComponents)
+	{
+		WorldPartition->Components.Remove(Component);
+
+		if (UFlowComponent* ValidComponent = Component.Get())
+		{
+			RemoveFromSpatialGrid(ValidComponent);
+			UnregisteredComponents.Emplace(ValidComponent);
+		}
+	}
+
+	OnLevelComponentsUnregistered.Broadcast(Level, UnregisteredComponents);
+}
+
+bool UFlowSubsystem::IsComponentRegistered(UFlowComponent* Component) const
+{
+	const FFlowWorldPartition* WorldPartition = FindWorldPartition(Component->GetWorld());
+	return WorldPartition && WorldPartition->Components.Contains(Component);
+}
+
+void UFlowSubsystem::AddToRegistry(const FGameplayTag& Tag, UFlowComponent* Component)
+{
+	FFlowWorldPartition* WorldPartition = FindOrAddWorldPartition(Component->GetWorld());
+	if (WorldPartition == nullptr)
+	{
+		return;
+	}
+
+	FlowComponentRegistry.Emplace(Tag, Component);
+
+	const UClass* ComponentClass = Component->GetClass();
+	const UClass* OwnerClass = Component->GetOwner() ? Component->GetOwner()->GetClass() : nullptr;
+
+	TArray<FFlowComponentClassPartition>& Partitions = WorldPartition->ClassPartitionedRegistry.FindOrAdd(Tag);
+	FFlowComponentClassPartition* Partition = Partitions.FindByPredicate([ComponentClass, OwnerClass](const FFlowComponentClassPartition& Entry)
+	{
+		return Entry.ComponentClass == ComponentClass && Entry.OwnerClass == OwnerClass;
+	});
+
+	if (Partition == nullptr)
+	{
+		Partition = &Partitions.Emplace_GetRef(ComponentClass, OwnerClass);
+	}
+	Partition->Components.AddUnique(Component);
+}
+
+void UFlowSubsystem::RemoveFromRegistry(const FGameplayTag& Tag, UFlowComponent* Component)
+{
+	FlowComponentRegistry.Remove(Tag, Component);
+
+	FFlowWorldPartition* WorldPartition = FindWorldPartition(Component->GetWorld());
+	TArray<FFlowComponentClassPartition>* Partitions = WorldPartition ? WorldPartition->ClassPartitionedRegistry.Find(Tag) : nullptr;
+	if (Partitions)
+	{
+		// owner class isn't checked here, the owner might be already gone while the component is being unregistered
+		for (int32 Index = Partitions->Num() - 1; Index >= 0; Index--)
+		{
+			FFlowComponentClassPartition& Partition = (*Partitions)[Index];
+			if (Partition.ComponentClass == Component->GetClass() && Partition.Components.RemoveSwap(Component) > 0)
+			{
+				if (Partition.Components.Num() == 0)
+				{
+					Partitions->RemoveAtSwap(Index);
+				}
+				break;
+			}
+		}
+
+		if (Partitions->Num() == 0)
+		{
+			WorldPartition->ClassPartitionedRegistry.Remove(Tag);
+		}
+	}
+}
+
+void UFlowSubsystem::AddRootInstance(UFlowAsset* Instance, UObject* Owner)
+{
+	RootInstances.Add(Instance, Owner);
+
+	// instances not bound to the world are saved regardless of the current world
+	const UWorld* World = Owner && Instance->IsBoundToWorld() ? Owner->GetWorld() : nullptr;
+	if (FFlowWorldPartition* WorldPartition = FindOrAddWorldPartition(World))
+	{
+		WorldPartition->RootInstances.Emplace(Instance);
+	}
+}
+
+void UFlowSubsystem::RemoveRootInstance(UFlowAsset* Instance)
+{
+	RootInstances.Remove(Instance);
+
+	for (TPair<TObjectKey<UWorld>, FFlowWorldPartition>& WorldPartition : WorldPartitions)
+	{
+		if (WorldPartition.Value.RootInstances.Remove(Instance) > 0)
+		{
+			break;
+		}
+	}
+}
+
+void UFlowSubsystem::AddToSpatialGrid(UFlowComponent* Component)
+{
+	FFlowWorldPartition* WorldPartition = FindOrAddWorldPartition(Component->GetWorld());
+	if (WorldPartition == nullptr || !WorldPartition->SpatialGrid.IsValid())
+	{
+		return;
+	}
+
+	USceneComponent* RootComponent = Component->GetOwner() ? Component->GetOwner()->GetRootComponent() : nullptr;
+	if (RootComponent == nullptr)
+	{
+		return;
+	}
+
+	WorldPartition->SpatialGrid->Add(Component, RootComponent->GetComponentLocation());
+
+	// only movable owners can leave their grid cell
+	if (RootComponent->Mobility == EComponentMobility::Movable && !WorldPartition->SpatiallyTrackedRoots.Contains(Component))
+	{
+		const FDelegateHandle Handle = RootComponent->TransformUpdated.AddUObject(this, &UFlowSubsystem::OnComponentOwnerMoved, TWeakObjectPtr<UFlowComponent>(Component));
+		WorldPartition->SpatiallyTrackedRoots.Emplace(Component, TPair<TWeakObjectPtr<USceneComponent>, FDelegateHandle>(RootComponent, Handle));
+	}
+}
+
+void UFlowSubsystem::RemoveFromSpatialGrid(UFlowComponent* Component)
+{
+	FFlowWorldPartition* WorldPartition = FindWorldPartition(Component->GetWorld());
+	if (WorldPartition == nullptr || !WorldPartition->SpatialGrid.IsValid())
+	{
+		return;
+	}
+
+	WorldPartition->SpatialGrid->Remove(Component);
+
+	TPair<TWeakObjectPtr<USceneComponent>, FDelegateHandle> TrackedRoot;
+	if (WorldPartition->SpatiallyTrackedRoots.RemoveAndCopyValue(Component, TrackedRoot))
+	{
+		if (USceneComponent* RootComponent = TrackedRoot.Key.Get())
+		{
+			RootComponent->TransformUpdated.Remove(TrackedRoot.Value);
+		}
+	}
+}
+
+void UFlowSubsystem::OnComponentOwnerMoved(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport, TWeakObjectPtr<UFlowComponent> Component)
+{
+	if (Component.IsValid())
+	{
+		FFlowWorldPartition* WorldPartition = FindWorldPartition(Component->GetWorld());
+		if (WorldPartition && WorldPartition->SpatialGrid.IsValid())
+		{
+			WorldPartition->SpatialGrid->Update(Component.Get(), UpdatedComponent->GetComponentLocation());
+		}
+	}
+}
+
+void UFlowSubsystem::RegisterComponent(UFlowComponent* Component)
+{
+	// world is being removed, its partition won't be created again
+	FFlowWorldPartition* WorldPartition = FindOrAddWorldPartition(Component->GetWorld());
+	if (WorldPartition == nullptr)
+	{
+		return;
+	}
+
+	for (const FGameplayTag& Tag : Component->IdentityTags)
+	{
+		if (Tag.IsValid())
+		{
+			AddToRegistry(Tag, Component);
+		}
+	}
+	WorldPartition->Components.Emplace(Component);
+	WorldPartition->ComponentsByLevel.FindOrAdd(Component->GetComponentLevel()).Emplace(Component);
+	AddToSpatialGrid(Component);
+
+	OnComponentRegistered.Broadcast(Component);
+}
+
+void UFlowSubsystem::OnIdentityTagAdded(UFlowComponent* Component, const FGameplayTag& AddedTag)
+{
+	// component might have been unregistered together with its level, and is only waiting for End Play
+	if (!IsComponentRegistered(Component))
+	{
+		return;
+	}
+
+	AddToRegistry(AddedTag, Component);
+
+	// broadcast OnComponentRegistered only if this component wasn't present in the registry previously
+	if (Component->IdentityTags.Num() > 1)
+	{
+		OnComponentTagAdded.Broadcast(Component, FGameplayTagContainer(AddedTag));
+	}
+	else
+	{
+		OnComponentRegistered.Broadcast(Component);
+	}
+}
+
+void UFlowSubsystem::OnIdentityTagsAdded(UFlowComponent* Component, const FGameplayTagContainer& AddedTags)
+{
+	// component might have been unregistered together with its level, and is only waiting for End Play
+	if (!IsComponentRegistered(Component))
+	{
+		return;
+	}
+
+	for (const FGameplayTag& Tag : AddedTags)
+	{
+		AddToRegistry(Tag, Component);
+	}
+
+	// broadcast OnComponentRegistered only if this component wasn't present in the registry previously
+	if (Component->IdentityTags.Num() > AddedTags.Num())
+	{
+		OnComponentTagAdded.Broadcast(Component, AddedTags);
+	}
+	else
+	{
+		OnComponentRegistered.Broadcast(Component);
+	}
+}
+
+void UFlowSubsystem::UnregisterComponent(UFlowComponent* Component)
+{
+	for (const FGameplayTag& Tag : Component->IdentityTags)
+	{
+		if (Tag.IsValid())
+		{
+			RemoveFromRegistry(Tag, Component);
+		}
+	}
+	RemoveFromSpatialGrid(Component);
+	if (FFlowWorldPartition* WorldPartition = FindWorldPartition(Component->GetWorld()))
+	{
+		WorldPartition->Components.Remove(Component);
+
+		const TObjectKey<ULevel> Level = Component->GetComponentLevel();
+		if (TSet<TWeakObjectPtr<UFlowComponent>>* LevelComponents = WorldPartition->ComponentsByLevel.Find(Level))
+		{
+			LevelComponents->Remove(Component);
+			if (LevelComponents->Num() == 0)
+			{
+				WorldPartition->ComponentsByLevel.Remove(Level);
+			}
+		}
+	}
+
+	OnComponentUnregistered.Broadcast(Component);
+}
+
+void UFlowSubsystem::OnIdentityTagRemoved(UFlowComponent* Component, const FGameplayTag& RemovedTag)
+{
+	// component might have been unregistered together with its level, and is only waiting for End Play
+	if (!IsComponentRegistered(Component))
+	{
+		return;
+	}
+
+	RemoveFromRegistry(RemovedTag, Component);
+
+	// broadcast OnComponentUnregistered only if this component isn't present in the registry anymore
+	if (Component->IdentityTags.Num() > 0)
+	{
+		OnComponentTagRemoved.Broadcast(Component, FGameplayTagContainer(RemovedTag));
+	}
+	else
+	{
+		OnComponentUnregistered.Broadcast(Component);
+	}
+}
+
+void UFlowSubsystem::OnIdentityTagsRemoved(UFlowComponent* Component, const FGameplayTagContainer& RemovedTags)
+{
+	// component might have been unregistered together with its level, and is only waiting for End Play
+	if (!IsComponentRegistered(Component))
+	{
+		return;
+	}
+
+	for (const FGameplayTag& Tag : RemovedTags)
+	{
+		RemoveFromRegistry(Tag, Component);
+	}
+
+	// broadcast OnComponentUnregistered only if this component isn't present in the registry anymore
+	if (Component->IdentityTags.Num() > 0)
+	{
+		OnComponentTagRemoved.Broadcast(Component, RemovedTags);
+	}
+	else
+	{
+		OnComponentUnregistered.Broadcast(Component);
+	}
+}
+
+void UFlowSubsystem::BulkNotifyActors(const TArray<FNotifyTagReplication>& Notifies, const EFlowNetMode NetMode /* = EFlowNetMode::Authority*/, const UObject* WorldContextObject /* = nullptr */)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+
+	// group Notify Tags by Actor Tag, so every target set is resolved only once
+	TMap<FGameplayTag, FGameplayTagContainer> NotifyTagsByActorTag;
+	for (const FNotifyTagReplication& Notify : Notifies)
+	{
+		if (Notify.ActorTag.IsValid() && Notify.NotifyTag.IsValid())
+		{
+			NotifyTagsByActorTag.FindOrAdd(Notify.ActorTag).AddTag(Notify.NotifyTag);
+		}
+	}
+
+	// merge Notify Tags per component, as a single component can be identified by many Actor Tags
+	TMap<TWeakObjectPtr<UFlowComponent>, FGameplayTagContainer> NotifyTagsByComponent;
+	TArray<TWeakObjectPtr<UFlowComponent>> FoundComponents;
+	for (const TPair<FGameplayTag, FGameplayTagContainer>& ActorTagNotifies : NotifyTagsByActorTag)
+	{
+		FoundComponents.Reset();
+		FindComponents(World, ActorTagNotifies.Key, true, nullptr, nullptr, FoundComponents);
+
+		for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+		{
+			if (Component.IsValid())
+			{
+				NotifyTagsByComponent.FindOrAdd(Component).AppendTags(ActorTagNotifies.Value);
+			}
+		}
+	}
+
+	for (const TPair<TWeakObjectPtr<UFlowComponent>, FGameplayTagContainer>& ComponentNotifies : NotifyTagsByComponent)
+	{
+		// recipient might have been destroyed by a notify delivered earlier in this loop
+		if (UFlowComponent* Component = ComponentNotifies.Key.Get())
+		{
+			Component->NotifyFromGraph(ComponentNotifies.Value, NetMode);
+		}
+	}
+}
+
+TSet<UFlowComponent*> UFlowSubsystem::GetFlowComponentsByTag(const FGameplayTag Tag, const TSubclassOf<UFlowComponent> ComponentClass, const bool bExactMatch, const UObject* WorldContextObject) const
+{
+	TArray<TWeakObjectPtr<UFlowComponent>> FoundComponents;
+	FindComponents(WorldContextObject ? WorldContextObject->GetWorld() : nullptr, Tag, bExactMatch, ComponentClass, nullptr, FoundComponents);
+
+	TSet<UFlowComponent*> Result;
+	for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+	{
+		if (Component.IsValid())
+		{
+			Result.Emplace(Component.Get());
+		}
+	}
+
+	return Result;
+}
+
+TSet<UFlowComponent*> UFlowSubsystem::GetFlowComponentsByTags(const FGameplayTagContainer Tags, const EGameplayContainerMatchType MatchType, const TSubclassOf<UFlowComponent> ComponentClass, const bool bExactMatch, const UObject* WorldContextObject) const
+{
+	TSet<TWeakObjectPtr<UFlowComponent>> FoundComponents;
+	FindComponents(WorldContextObject ? WorldContextObject->GetWorld() : nullptr, Tags, MatchType, bExactMatch, ComponentClass, nullptr, FoundComponents);
+
+	TSet<UFlowComponent*> Result;
+	for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+	{
+		if (Component.IsValid())
+		{
+			Result.Emplace(Component.Get());
+		}
+	}
+
+	return Result;
+}
+
+TSet<AActor*> UFlowSubsystem::GetFlowActorsByTag(const FGameplayTag Tag, const TSubclassOf<AActor> ActorClass, const bool bExactMatch, const UObject* WorldContextObject) const
+{
+	TArray<TWeakObjectPtr<UFlowComponent>> FoundComponents;
+	FindComponents(WorldContextObject ? WorldContextObject->GetWorld() : nullptr, Tag, bExactMatch, nullptr, ActorClass, FoundComponents);
+
+	TSet<AActor*> Result;
+	for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+	{
+		if (Component.IsValid())
+		{
+			Result.Emplace(Component->GetOwner());
+		}
+	}
+
+	return Result;
+}
+
+TSet<AActor*> UFlowSubsystem::GetFlowActorsByTags(const FGameplayTagContainer Tags, const EGameplayContainerMatchType MatchType, const TSubclassOf<AActor> ActorClass, const bool bExactMatch, const UObject* WorldContextObject) const
+{
+	TSet<TWeakObjectPtr<UFlowComponent>> FoundComponents;
+	FindComponents(WorldContextObject ? WorldContextObject->GetWorld() : nullptr, Tags, MatchType, bExactMatch, nullptr, ActorClass, FoundComponents);
+
+	TSet<AActor*> Result;
+	for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+	{
+		if (Component.IsValid())
+		{
+			Result.Emplace(Component->GetOwner());
+		}
+	}
+
+	return Result;
+}
+
+TMap<AActor*, UFlowComponent*> UFlowSubsystem::GetFlowActorsAndComponentsByTag(const FGameplayTag Tag, const TSubclassOf<AActor> ActorClass, const bool bExactMatch, const UObject* WorldContextObject) const
+{
+	TArray<TWeakObjectPtr<UFlowComponent>> FoundComponents;
+	FindComponents(WorldContextObject ? WorldContextObject->GetWorld() : nullptr, Tag, bExactMatch, nullptr, ActorClass, FoundComponents);
+
+	TMap<AActor*, UFlowComponent*> Result;
+	for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+	{
+		if (Component.IsValid())
+		{
+			Result.Emplace(Component->GetOwner(), Component.Get());
+		}
+	}
+
+	return Result;
+}
+
+TMap<AActor*, UFlowComponent*> UFlowSubsystem::GetFlowActorsAndComponentsByTags(const FGameplayTagContainer Tags, const EGameplayContainerMatchType MatchType, const TSubclassOf<AActor> ActorClass, const bool bExactMatch, const UObject* WorldContextObject) const
+{
+	TSet<TWeakObjectPtr<UFlowComponent>> FoundComponents;
+	FindComponents(WorldContextObject ? WorldContextObject->GetWorld() : nullptr, Tags, MatchType, bExactMatch, nullptr, ActorClass, FoundComponents);
+
+	TMap<AActor*, UFlowComponent*> Result;
+	for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+	{
+		if (Component.IsValid())
+		{
+			Result.Emplace(Component->GetOwner(), Component.Get());
+		}
+	}
+
+	return Result;
+}
+
+TSet<UFlowComponent*> UFlowSubsystem::GetFlowComponentsByTagInRadius(const UObject* WorldContextObject, const FGameplayTag Tag, const FVector Center, const float Radius, const TSubclassOf<UFlowComponent> ComponentClass, const bool bExactMatch) const
+{
+	TSet<UFlowComponent*> Result;
+	if (!Tag.IsValid() || Radius < 0.0f)
+	{
+		return Result;
+	}
+
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : GetWorld();
+	const FFlowWorldPartition* WorldPartition = FindWorldPartition(World);
+	if (WorldPartition && WorldPartition->SpatialGrid.IsValid())
+	{
+		TArray<UFlowComponent*> FoundComponents;
+		WorldPartition->SpatialGrid->QuerySphere(Center, Radius, [&Tag, &ComponentClass, bExactMatch](const UFlowComponent& Component)
+		{
+			return (bExactMatch ? Component.IdentityTags.HasTagExact(Tag) : Component.IdentityTags.HasTag(Tag))
+				&& (ComponentClass == nullptr || Component.GetClass()->IsChildOf(ComponentClass));
+		}, FoundComponents);
+
+		Result.Append(FoundComponents);
+	}
+	else
+	{
+		TArray<TWeakObjectPtr<UFlowComponent>> FoundComponents;
+		FindComponents(World, Tag, bExactMatch, ComponentClass, nullptr, FoundComponents);
+
+		const double RadiusSquared = FMath::Square(static_cast<double>(Radius));
+		for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+		{
+			FVector OwnerLocation;
+			if (Component.IsValid() && GetOwnerLocation(*Component, OwnerLocation) && FVector::DistSquared(OwnerLocation, Center) <= RadiusSquared)
+			{
+				Result.Emplace(Component.Get());
+			}
+		}
+	}
+
+	return Result;
+}
+
+TSet<UFlowComponent*> UFlowSubsystem::GetFlowComponentsByTagInBox(const UObject* WorldContextObject, const FGameplayTag Tag, const FBox Bounds, const TSubclassOf<UFlowComponent> ComponentClass, const bool bExactMatch) const
+{
+	TSet<UFlowComponent*> Result;
+	if (!Tag.IsValid() || !Bounds.IsValid)
+	{
+		return Result;
+	}
+
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : GetWorld();
+	const FFlowWorldPartition* WorldPartition = FindWorldPartition(World);
+	if (WorldPartition && WorldPartition->SpatialGrid.IsValid())
+	{
+		TArray<UFlowComponent*> FoundComponents;
+		WorldPartition->SpatialGrid->QueryBox(Bounds, [&Tag, &ComponentClass, bExactMatch](const UFlowComponent& Component)
+		{
+			return (bExactMatch ? Component.IdentityTags.HasTagExact(Tag) : Component.IdentityTags.HasTag(Tag))
+				&& (ComponentClass == nullptr || Component.GetClass()->IsChildOf(ComponentClass));
+		}, FoundComponents);
+
+		Result.Append(FoundComponents);
+	}
+	else
+	{
+		TArray<TWeakObjectPtr<UFlowComponent>> FoundComponents;
+		FindComponents(World, Tag, bExactMatch, ComponentClass, nullptr, FoundComponents);
+
+		for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+		{
+			FVector OwnerLocation;
+			if (Component.IsValid() && GetOwnerLocation(*Component, OwnerLocation) && Bounds.IsInsideOrOn(OwnerLocation))
+			{
+				Result.Emplace(Component.Get());
+			}
+		}
+	}
+
+	return Result;
+}
+
+UFlowComponent* UFlowSubsystem::GetNearestFlowComponentByTag(const UObject* WorldContextObject, const FGameplayTag Tag, const FVector Location, const float MaxDistance, const TSubclassOf<UFlowComponent> ComponentClass, const bool bExactMatch) const
+{
+	if (!Tag.IsValid())
+	{
+		return nullptr;
+	}
+
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : GetWorld();
+	const FFlowWorldPartition* WorldPartition = FindWorldPartition(World);
+
+	// unlimited query would visit every cell of the grid, the tag registry holds only matching components
+	if (MaxDistance > 0.0f && WorldPartition && WorldPartition->SpatialGrid.IsValid())
+	{
+		return WorldPartition->SpatialGrid->FindNearest(Location, MaxDistance, [&Tag, &ComponentClass, bExactMatch](const UFlowComponent& Component)
+		{
+			return (bExactMatch ? Component.IdentityTags.HasTagExact(Tag) : Component.IdentityTags.HasTag(Tag))
+				&& (ComponentClass == nullptr || Component.GetClass()->IsChildOf(ComponentClass));
+		});
+	}
+
+	TArray<TWeakObjectPtr<UFlowComponent>> FoundComponents;
+	FindComponents(World, Tag, bExactMatch, ComponentClass, nullptr, FoundComponents);
+
+	UFlowComponent* Nearest = nullptr;
+	double NearestDistanceSquared = MaxDistance > 0.0f ? FMath::Square(static_cast<double>(MaxDistance)) : TNumericLimits<double>::Max();
+	for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
+	{
+		FVector OwnerLocation;
+		if (Component.IsValid() && GetOwnerLocation(*Component, OwnerLocation))
+		{
+			const double DistanceSquared = FVector::DistSquared(OwnerLocation, Location);
+			if (DistanceSquared <= NearestDistanceSquared)
+			{
+				Nearest = Component.Get();
+				NearestDistanceSquared = DistanceSquared;
+			}
+		}
+	}
+
+	return Nearest;
+}
+
+void UFlowSubsystem::FindComponents(const FGameplayTag& Tag, const bool bExactMatch, TArray<TWeakObjectPtr<UFlowComponent>>& OutComponents) const
+{
+	if (bExactMatch)
+	{
+		FlowComponentRegistry.MultiFind(Tag, OutComponents);
+	}
+	else
+	{
+		for (TMultiMap<FGameplayTag, TWeakObjectPtr<UFlowComponent>>::TConstIterator It(FlowComponentRegistry); It; ++It)
+		{
+			if (It.Key().MatchesTag(Tag))
+			{
+				OutComponents.Emplace(It.Value());
+			}
+		}
+	}
+}
+
+void UFlowSubsystem::FindComponents(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch, TSet<TWeakObjectPtr<UFlowComponent>>& OutComponents) const
+{
+	if (MatchType == EGameplayContainerMatchType::Any)
+	{
+		for (const FGameplayTag& Tag : Tags)
+		{
+			TArray<TWeakObjectPtr<UFlowComponent>> ComponentsPerTag;
+			FindComponents(Tag, bExactMatch, ComponentsPerTag);
+			OutComponents.Append(ComponentsPerTag);
+		}
+	}
+	else // EGameplayContainerMatchType::All
+	{
+		TSet<TWeakObjectPtr<UFlowComponent>> ComponentsWithAnyTag;
 		for (const FGameplayTag& Tag : Tags)
 		{
 			TArray<TWeakObjectPtr<UFlowComponent>> ComponentsPerTag;
@@ -664,4 +1623,102 @@ void UFlowSubsystem::FindComponents(const FGameplayTagContainer& Tags, const EGa
 	}
 }
 
+void UFlowSubsystem::FindComponents(const UWorld* World, const FGameplayTag& Tag, const bool bExactMatch, const UClass* ComponentClass, const UClass* ActorClass, TArray<TWeakObjectPtr<UFlowComponent>>& OutComponents) const
+{
+	auto AppendMatchingPartitions = [ComponentClass, ActorClass, &OutComponents](const TArray<FFlowComponentClassPartition>& Partitions)
+	{
+		// class check is done once per partition, components of other classes aren't touched at all
+		for (const FFlowComponentClassPartition& Partition : Partitions)
+		{
+			if ((ComponentClass == nullptr || Partition.ComponentClass->IsChildOf(ComponentClass))
+				&& (ActorClass == nullptr || (Partition.OwnerClass && Partition.OwnerClass->IsChildOf(ActorClass))))
+			{
+				OutComponents.Append(Partition.Components);
+			}
+		}
+	};
+
+	auto FindInWorldPartition = [&Tag, bExactMatch, &AppendMatchingPartitions](const FFlowWorldPartition& WorldPartition)
+	{
+		if (bExactMatch)
+		{
+			if (const TArray<FFlowComponentClassPartition>* Partitions = WorldPartition.ClassPartitionedRegistry.Find(Tag))
+			{
+				AppendMatchingPartitions(*Partitions);
+			}
+		}
+		else
+		{
+			for (const TPair<FGameplayTag, TArray<FFlowComponentClassPartition>>& TagPartitions : WorldPartition.ClassPartitionedRegistry)
+			{
+				if (TagPartitions.Key.MatchesTag(Tag))
+				{
+					AppendMatchingPartitions(TagPartitions.Value);
+				}
+			}
+		}
+	};
+
+	if (World)
+	{
+		if (const FFlowWorldPartition* WorldPartition = FindWorldPartition(World))
+		{
+			FindInWorldPartition(*WorldPartition);
+		}
+	}
+	else
+	{
+		for (const TPair<TObjectKey<UWorld>, FFlowWorldPartition>& WorldPartition : WorldPartitions)
+		{
+			FindInWorldPartition(WorldPartition.Value);
+		}
+	}
+}
+
+void UFlowSubsystem::FindComponents(const UWorld* World, const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch, const UClass* ComponentClass, const UClass* ActorClass, TSet<TWeakObjectPtr<UFlowComponent>>& OutComponents) const
+{
+	TArray<TWeakObjectPtr<UFlowComponent>> ComponentsPerTag;
+	if (MatchType == EGameplayContainerMatchType::Any)
+	{
+		for (const FGameplayTag& Tag : Tags)
+		{
+			ComponentsPerTag.Reset();
+			FindComponents(World, Tag, bExactMatch, ComponentClass, ActorClass, ComponentsPerTag);
+			OutComponents.Append(ComponentsPerTag);
+		}
+	}
+	else // EGameplayContainerMatchType::All
+	{
+		TSet<TWeakObjectPtr<UFlowComponent>> ComponentsWithAnyTag;
+		for (const FGameplayTag& Tag : Tags)
+		{
+			ComponentsPerTag.Reset();
+			FindComponents(World, Tag, bExactMatch, ComponentClass, ActorClass, ComponentsPerTag);
+			ComponentsWithAnyTag.Append(ComponentsPerTag);
+		}
+
+		for (const TWeakObjectPtr<UFlowComponent>& Component : ComponentsWithAnyTag)
+		{
+			if (Component.IsValid() && Component->IdentityTags.HasAllExact(Tags))
+			{
+				OutComponents.Emplace(Component);
+			}
+		}
+	}
+}
+
+bool UFlowSubsystem::GetOwnerLocation(const UFlowComponent& Component, FVector& OutLocation)
+{
+	if (const AActor* Owner = Component.GetOwner())
+	{
+		if (const USceneComponent* RootComponent = Owner->GetRootComponent())
+		{
+			OutLocation = RootComponent->GetComponentLocation();
+			return true;
+		}
+	}
+
+	return false;
+}
+
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,139 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "FlowTrace.h"
+
+#if FLOW_TRACE_ENABLED
+
+#include "FlowAsset.h"
+#include "Nodes/FlowNode.h"
+#include "Types/FlowDataPinResults.h"
+
+#include "Trace/Trace.inl"
+
+UE_TRACE_CHANNEL_DEFINE(FlowChannel)
+
+UE_TRACE_EVENT_BEGIN(Flow, InstanceCreated)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, InstanceId)
+	UE_TRACE_EVENT_FIELD(uint32, OwnerId)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, TemplatePath)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, InstanceName)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Flow, InstanceDestroyed)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, InstanceId)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Flow, NodeActivated)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, InstanceId)
+	UE_TRACE_EVENT_FIELD(uint32, NodeId)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, NodeGuid)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, NodeClass)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Flow, NodeFinished)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, InstanceId)
+	UE_TRACE_EVENT_FIELD(uint32, NodeId)
+	UE_TRACE_EVENT_FIELD(uint8, State)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Flow, PinTriggered)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, InstanceId)
+	UE_TRACE_EVENT_FIELD(uint32, NodeId)
+	UE_TRACE_EVENT_FIELD(bool, bInput)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, PinName)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(Flow, DataPinResolved)
+	UE_TRACE_EVENT_FIELD(uint64, StartCycle)
+	UE_TRACE_EVENT_FIELD(uint64, EndCycle)
+	UE_TRACE_EVENT_FIELD(uint32, InstanceId)
+	UE_TRACE_EVENT_FIELD(uint32, NodeId)
+	UE_TRACE_EVENT_FIELD(uint8, Result)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, PinName)
+UE_TRACE_EVENT_END()
+
+namespace FlowTrace
+{
+	uint32 GetInstanceId(const UFlowNodeBase& Node)
+	{
+		const UFlowAsset* FlowAsset = Node.GetFlowAsset();
+		return FlowAsset ? FlowAsset->GetUniqueID() : 0;
+	}
+}
+
+void FFlowTrace::OutputInstanceCreated(const UFlowAsset& Instance)
+{
+	const FString TemplatePath = Instance.GetTemplateAsset() ? Instance.GetTemplateAsset()->GetPathName() : FString();
+	const FString InstanceName = Instance.GetName();
+	const UObject* Owner = Instance.GetOwner();
+
+	UE_TRACE_LOG(Flow, InstanceCreated, FlowChannel)
+		<< InstanceCreated.Cycle(FPlatformTime::Cycles64())
+		<< InstanceCreated.InstanceId(Instance.GetUniqueID())
+		<< InstanceCreated.OwnerId(Owner ? Owner->GetUniqueID() : 0)
+		<< InstanceCreated.TemplatePath(*TemplatePath, TemplatePath.Len())
+		<< InstanceCreated.InstanceName(*InstanceName, InstanceName.Len());
+}
+
+void FFlowTrace::OutputInstanceDestroyed(const UFlowAsset& Instance)
+{
+	UE_TRACE_LOG(Flow, InstanceDestroyed, FlowChannel)
+		<< InstanceDestroyed.Cycle(FPlatformTime::Cycles64())
+		<< InstanceDestroyed.InstanceId(Instance.GetUniqueID());
+}
+
+void FFlowTrace::OutputNodeActivated(const UFlowNode& Node)
+{
+	const FString NodeGuid = Node.GetGuid().ToString();
+	const FString NodeClass = Node.GetClass()->GetName();
+
+	UE_TRACE_LOG(Flow, NodeActivated, FlowChannel)
+		<< NodeActivated.Cycle(FPlatformTime::Cycles64())
+		<< NodeActivated.InstanceId(FlowTrace::GetInstanceId(Node))
+		<< NodeActivated.NodeId(Node.GetUniqueID())
+		<< NodeActivated.NodeGuid(*NodeGuid, NodeGuid.Len())
+		<< NodeActivated.NodeClass(*NodeClass, NodeClass.Len());
+}
+
+void FFlowTrace::OutputNodeFinished(const UFlowNode& Node)
+{
+	UE_TRACE_LOG(Flow, NodeFinished, FlowChannel)
+		<< NodeFinished.Cycle(FPlatformTime::Cycles64())
+		<< NodeFinished.InstanceId(FlowTrace::GetInstanceId(Node))
+		<< NodeFinished.NodeId(Node.GetUniqueID())
+		<< NodeFinished.State(static_cast<uint8>(Node.GetActivationState()));
+}
+
+void FFlowTrace::OutputPinTriggered(const UFlowNode& Node, const FName& PinName, const bool bInput)
+{
+	TStringBuilder<64> PinNameString;
+	PinName.AppendString(PinNameString);
+
+	UE_TRACE_LOG(Flow, PinTriggered, FlowChannel)
+		<< PinTriggered.Cycle(FPlatformTime::Cycles64())
+		<< PinTriggered.InstanceId(FlowTrace::GetInstanceId(Node))
+		<< PinTriggered.NodeId(Node.GetUniqueID())
+		<< PinTriggered.bInput(bInput)
+		<< PinTriggered.PinName(PinNameString.GetData(), PinNameString.Len());
+}
+
+void FFlowTrace::OutputDataPinResolved(const UFlowNodeBase& Node, const FName& PinName, const uint64 StartCycle, const EFlowDataPinResolveResult Result)
+{
+	TStringBuilder<64> PinNameString;
+	PinName.AppendString(PinNameString);
+
+	UE_TRACE_LOG(Flow, DataPinResolved, FlowChannel)
+		<< DataPinResolved.StartCycle(StartCycle)
+		<< DataPinResolved.EndCycle(FPlatformTime::Cycles64())
+		<< DataPinResolved.InstanceId(FlowTrace::GetInstanceId(Node))
+		<< DataPinResolved.NodeId(Node.GetUniqueID())
+		<< DataPinResolved.Result(static_cast<uint8>(Result))
+		<< DataPinResolved.PinName(PinNameString.GetData(), PinNameString.Len());
+}
+
+#endif
@@ -2,6 +2,11 @@
 
 #include "FlowWorldSettings.h"
 #include "FlowComponent.h"
+#include "FlowPreloadManifest.h"
+#include "FlowSubsystem.h"
+
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowWorldSettings)
 
@@ -14,3 +19,21 @@ AFlowWorldSettings::AFlowWorldSettings(const FObjectInitializer& ObjectInitializ
 	// In this case engine would call BeginPlay multiple times... for AFlowWorldSettings and every inherited AWorldSettings class...
 	FlowComponent->bAllowMultipleInstances = false;
 }
+
+void AFlowWorldSettings::PreInitializeComponents()
+{
+	Super::PreInitializeComponents();
+
+	if (PreloadManifest.IsNull() || !GetWorld()->IsGameWorld())
+	{
+		return;
+	}
+
+	if (const UGameInstance* GameInstance = GetWorld()->GetGameInstance())
+	{
+		if (UFlowSubsystem* FlowSubsystem = GameInstance->GetSubsystem<UFlowSubsystem>())
+		{
+			FlowSubsystem->PreloadManifest(PreloadManifest.LoadSynchronous(), this);
+		}
+	}
+}
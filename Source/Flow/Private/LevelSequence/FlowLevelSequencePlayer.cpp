@@ -37,18 +37,7 @@ UFlowLevelSequencePlayer* UFlowLevelSequencePlayer::CreateFlowLevelSequencePlaye
 		return nullptr;
 	}
 
-	// Sequence Actor might be spawned exactly where playback happens
-	FTransform SpawnTransform = FTransform::Identity;
-	{
-		// apply Transform Origin
-		// https://dev.epicgames.com/documentation/en-us/unreal-engine/creating-level-sequences-with-dynamic-transforms-in-unreal-engine
-		if (TransformOriginActor->IsValidLowLevel())
-		{
-			// moving Level Sequence Actor might allow proper distance-based actor replication in networked games
-			SpawnTransform = TransformOriginActor->GetTransform();
-			SpawnTransform = FTransform(SpawnTransform.GetRotation(), SpawnTransform.GetLocation(), FVector::OneVector);
-		}
-	}
+	const FTransform SpawnTransform = GetSequenceActorTransform(TransformOriginActor);
 
 	// Create Sequence Actor
 	// We use deferred spawn, so we can set all actor properties prior to its initialization.
@@ -58,14 +47,7 @@ UFlowLevelSequencePlayer* UFlowLevelSequencePlayer::CreateFlowLevelSequencePlaye
 	Actor->CameraSettings = CameraSettings;
 
 	// apply Transform Origin to spawned actor
-	if (TransformOriginActor->IsValidLowLevel())
-	{
-		if (UDefaultLevelSequenceInstanceData* InstanceData = Cast<UDefaultLevelSequenceInstanceData>(Actor->DefaultInstanceData))
-		{
-			Actor->bOverrideInstanceData = true;
-			InstanceData->TransformOriginActor = TransformOriginActor;
-		}
-	}
+	ApplyTransformOrigin(*Actor, TransformOriginActor);
 
 	// support networking
 	if (bReplicates)
@@ -87,6 +69,41 @@ UFlowLevelSequencePlayer* UFlowLevelSequencePlayer::CreateFlowLevelSequencePlaye
 	return Cast<UFlowLevelSequencePlayer>(Actor->GetSequencePlayer());
 }
 
+FTransform UFlowLevelSequencePlayer::GetSequenceActorTransform(const AActor* TransformOriginActor)
+{
+	// apply Transform Origin
+	// https://dev.epicgames.com/documentation/en-us/unreal-engine/creating-level-sequences-with-dynamic-transforms-in-unreal-engine
+	if (TransformOriginActor->IsValidLowLevel())
+	{
+		// moving Level Sequence Actor might allow proper distance-based actor replication in networked games
+		const FTransform OriginTransform = TransformOriginActor->GetTransform();
+		return FTransform(OriginTransform.GetRotation(), OriginTransform.GetLocation(), FVector::OneVector);
+	}
+
+	return FTransform::Identity;
+}
+
+bool UFlowLevelSequencePlayer::ApplyTransformOrigin(ALevelSequenceActor& Actor, AActor* TransformOriginActor)
+{
+	UDefaultLevelSequenceInstanceData* InstanceData = Cast<UDefaultLevelSequenceInstanceData>(Actor.DefaultInstanceData);
+	if (InstanceData == nullptr)
+	{
+		return false;
+	}
+
+	AActor* NewTransformOriginActor = TransformOriginActor->IsValidLowLevel() ? TransformOriginActor : nullptr;
+	const bool bNewOverrideInstanceData = NewTransformOriginActor != nullptr;
+
+	if (Actor.bOverrideInstanceData == bNewOverrideInstanceData && InstanceData->TransformOriginActor == NewTransformOriginActor)
+	{
+		return false;
+	}
+
+	Actor.bOverrideInstanceData = bNewOverrideInstanceData;
+	InstanceData->TransformOriginActor = NewTransformOriginActor;
+	return true;
+}
+
 TArray<UObject*> UFlowLevelSequencePlayer::GetEventContexts() const
 {
 	TArray<UObject*> EventContexts;
@@ -0,0 +1,102 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "LevelSequence/FlowLevelSequencePool.h"
+#include "LevelSequence/FlowLevelSequenceActor.h"
+#include "LevelSequence/FlowLevelSequencePlayer.h"
+#include "FlowSettings.h"
+
+#include "Engine/World.h"
+#include "LevelSequence.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FlowLevelSequencePool)
+
+bool UFlowLevelSequencePool::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UFlowLevelSequencePool::Deinitialize()
+{
+	// actors are destroyed together with the world
+	PooledActors.Empty();
+
+	Super::Deinitialize();
+}
+
+UFlowLevelSequencePlayer* UFlowLevelSequencePool::AcquirePlayer(
+	ULevelSequence* LevelSequence,
+	const FMovieSceneSequencePlaybackSettings& Settings,
+	const FLevelSequenceCameraSettings& CameraSettings,
+	AActor* TransformOriginActor,
+	const bool bReplicates,
+	const bool bAlwaysRelevant,
+	ALevelSequenceActor*& OutActor)
+{
+	if (LevelSequence == nullptr)
+	{
+		return nullptr;
+	}
+
+	if (TArray<TWeakObjectPtr<AFlowLevelSequenceActor>>* Actors = PooledActors.Find(FFlowLevelSequencePoolKey(LevelSequence, bReplicates, bAlwaysRelevant)))
+	{
+		while (Actors->Num() > 0)
+		{
+			AFlowLevelSequenceActor* Actor = Actors->Pop(EAllowShrinking::No).Get();
+			if (IsValid(Actor) && Actor->GetSequencePlayer())
+			{
+				Actor->SetActorTransform(UFlowLevelSequencePlayer::GetSequenceActorTransform(TransformOriginActor));
+				Actor->SetPlaybackSettings(Settings);
+				Actor->CameraSettings = CameraSettings;
+
+				// Transform Origin is read while initializing the player, so it needs to be initialized again if instance data changed
+				if (UFlowLevelSequencePlayer::ApplyTransformOrigin(*Actor, TransformOriginActor))
+				{
+					Actor->InitializePlayer();
+				}
+
+				OutActor = Actor;
+				return Cast<UFlowLevelSequencePlayer>(Actor->GetSequencePlayer());
+			}
+		}
+	}
+
+	return UFlowLevelSequencePlayer::CreateFlowLevelSequencePlayer(this, LevelSequence, Settings, CameraSettings, TransformOriginActor, bReplicates, bAlwaysRelevant, OutActor);
+}
+
+void UFlowLevelSequencePool::ReleasePlayer(ALevelSequenceActor* SequenceActor)
+{
+	AFlowLevelSequenceActor* Actor = Cast<AFlowLevelSequenceActor>(SequenceActor);
+	if (!IsValid(Actor))
+	{
+		return;
+	}
+
+	if (UFlowLevelSequencePlayer* Player = Cast<UFlowLevelSequencePlayer>(Actor->GetSequencePlayer()))
+	{
+		Player->Stop();
+		Player->SetFlowEventReceiver(nullptr);
+	}
+
+	const int32 MaxPooledActors = UFlowSettings::Get()->MaxPooledLevelSequenceActors;
+	if (MaxPooledActors > 0 && Actor->GetSequence())
+	{
+		TArray<TWeakObjectPtr<AFlowLevelSequenceActor>>& Actors = PooledActors.FindOrAdd(FFlowLevelSequencePoolKey(Actor->GetSequence(), Actor->bReplicatePlayback, Actor->bAlwaysRelevant));
+		if (Actors.Num() < MaxPooledActors)
+		{
+			Actors.Emplace(Actor);
+			return;
+		}
+	}
+
+	Actor->Destroy();
+}
+
+int32 UFlowLevelSequencePool::GetNumPooledActors() const
+{
+	int32 Result = 0;
+	for (const TPair<FFlowLevelSequencePoolKey, TArray<TWeakObjectPtr<AFlowLevelSequenceActor>>>& Pair : PooledActors)
+	{
+		Result += Pair.Value.Num();
+	}
+	return Result;
+}
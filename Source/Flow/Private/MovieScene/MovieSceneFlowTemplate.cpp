@@ -4,6 +4,8 @@
 #include "MovieScene/MovieSceneFlowTrack.h"
 #include "Nodes/Actor/FlowNode_PlayLevelSequence.h"
 
+#include "Algo/BinarySearch.h"
+#include "Algo/StableSort.h"
 #include "Evaluation/MovieSceneEvaluation.h"
 #include "IMovieScenePlayer.h"
 
@@ -13,24 +15,27 @@
 
 DECLARE_CYCLE_STAT(TEXT("Flow Track Token Execute"), MovieSceneEval_FlowTrack_TokenExecute, STATGROUP_MovieSceneEval);
 
+// Most of the time only a few events are triggered within a single frame
+using FFlowTrackEventNames = TArray<FName, TInlineAllocator<4>>;
+
 struct FFlowTrackExecutionToken final : IMovieSceneExecutionToken
 {
-	FFlowTrackExecutionToken(TArray<FString> InEventNames)
+	FFlowTrackExecutionToken(FFlowTrackEventNames&& InEventNames)
 		: EventNames(MoveTemp(InEventNames))
 	{
 	}
 
-	TArray<FString> EventNames;
+	FFlowTrackEventNames EventNames;
 
 	virtual void Execute(const FMovieSceneContext& Context, const FMovieSceneEvaluationOperand& Operand, FPersistentEvaluationData& PersistentData, IMovieScenePlayer& Player) override
 	{
 		MOVIESCENE_DETAILED_SCOPE_CYCLE_COUNTER(MovieSceneEval_FlowTrack_TokenExecute)
 
-		for (const FString& EventName : EventNames)
+		for (UObject* EventReceiver : Player.GetEventContexts())
 		{
-			for (UObject* EventReceiver : Player.GetEventContexts())
+			if (UFlowNode_PlayLevelSequence* FlowNode = Cast<UFlowNode_PlayLevelSequence>(EventReceiver))
 			{
-				if (UFlowNode_PlayLevelSequence* FlowNode = Cast<UFlowNode_PlayLevelSequence>(EventReceiver))
+				for (const FName& EventName : EventNames)
 				{
 					FlowNode->TriggerEvent(EventName);
 				}
@@ -46,13 +51,29 @@ FMovieSceneFlowTriggerTemplate::FMovieSceneFlowTriggerTemplate(const UMovieScene
 	const TArrayView<const FFrameNumber> Times = EventData.GetTimes();
 	const TArrayView<const FString> EntryPoints = EventData.GetValues();
 
-	EventTimes.Reserve(Times.Num());
-	EventNames.Reserve(Times.Num());
-
+	TArray<int32> SortedIndices;
+	SortedIndices.Reserve(Times.Num());
 	for (int32 Index = 0; Index < Times.Num(); ++Index)
+	{
+		if (!EntryPoints[Index].IsEmpty())
+		{
+			SortedIndices.Add(Index);
+		}
+	}
+
+	// channel keys are expected to be sorted already, stable sort keeps the order of events placed on the same frame
+	Algo::StableSort(SortedIndices, [&Times](const int32 A, const int32 B)
+	{
+		return Times[A] < Times[B];
+	});
+
+	EventTimes.Reserve(SortedIndices.Num());
+	EventNames.Reserve(SortedIndices.Num());
+
+	for (const int32 Index : SortedIndices)
 	{
 		EventTimes.Add(Times[Index]);
-		EventNames.Add(EntryPoints[Index]);
+		EventNames.Add(FName(*EntryPoints[Index]));
 	}
 }
 
@@ -73,42 +94,60 @@ void FMovieSceneFlowTriggerTemplate::EvaluateSwept(const FMovieSceneEvaluationOp
 		return;
 	}
 
-	TArray<FString> EventsToTrigger;
+	// Find the range of sorted keys within the swept range
+	int32 FirstIndex = 0;
+	const TRangeBound<FFrameNumber> SweptLowerBound = SweptRange.GetLowerBound();
+	if (SweptLowerBound.IsInclusive())
+	{
+		FirstIndex = Algo::LowerBound(EventTimes, SweptLowerBound.GetValue());
+	}
+	else if (SweptLowerBound.IsExclusive())
+	{
+		FirstIndex = Algo::UpperBound(EventTimes, SweptLowerBound.GetValue());
+	}
+
+	int32 EndIndex = EventTimes.Num();
+	const TRangeBound<FFrameNumber> SweptUpperBound = SweptRange.GetUpperBound();
+	if (SweptUpperBound.IsInclusive())
+	{
+		EndIndex = Algo::UpperBound(EventTimes, SweptUpperBound.GetValue());
+	}
+	else if (SweptUpperBound.IsExclusive())
+	{
+		EndIndex = Algo::LowerBound(EventTimes, SweptUpperBound.GetValue());
+	}
+
+	if (FirstIndex >= EndIndex)
+	{
+		return;
+	}
+
+	FFlowTrackEventNames EventsToTrigger;
+	EventsToTrigger.Reserve(EndIndex - FirstIndex);
 
 	if (bBackwards)
 	{
 		// Trigger events backwards
-		for (int32 KeyIndex = EventTimes.Num() - 1; KeyIndex >= 0; --KeyIndex)
+		for (int32 KeyIndex = EndIndex - 1; KeyIndex >= FirstIndex; --KeyIndex)
 		{
-			FFrameNumber Time = EventTimes[KeyIndex];
-			if (!EventNames[KeyIndex].IsEmpty() && SweptRange.Contains(Time))
-			{
-				EventsToTrigger.Add(EventNames[KeyIndex]);
-			}
+			EventsToTrigger.Add(EventNames[KeyIndex]);
 		}
 	}
 	else
 	{
 		// Trigger events forwards
-		for (int32 KeyIndex = 0; KeyIndex < EventTimes.Num(); ++KeyIndex)
+		for (int32 KeyIndex = FirstIndex; KeyIndex < EndIndex; ++KeyIndex)
 		{
-			FFrameNumber Time = EventTimes[KeyIndex];
-			if (!EventNames[KeyIndex].IsEmpty() && SweptRange.Contains(Time))
-			{
-				EventsToTrigger.Add(EventNames[KeyIndex]);
-			}
+			EventsToTrigger.Add(EventNames[KeyIndex]);
 		}
 	}
 
-	if (EventsToTrigger.Num())
-	{
-		ExecutionTokens.Add(FFlowTrackExecutionToken(MoveTemp(EventsToTrigger)));
-	}
+	ExecutionTokens.Add(FFlowTrackExecutionToken(MoveTemp(EventsToTrigger)));
 }
 
 FMovieSceneFlowRepeaterTemplate::FMovieSceneFlowRepeaterTemplate(const UMovieSceneFlowRepeaterSection& Section, const UMovieSceneFlowTrack& Track)
 	: FMovieSceneFlowTemplateBase(Track, Section)
-	, EventName(Section.EventName)
+	, EventName(Section.EventName.IsEmpty() ? NAME_None : FName(*Section.EventName))
 {
 }
 
@@ -120,14 +159,16 @@ void FMovieSceneFlowRepeaterTemplate::EvaluateSwept(const FMovieSceneEvaluationO
 	// Don't allow events to fire when playback is in a stopped state. This can occur when stopping 
 	// playback and returning the current position to the start of playback. It's not desirable to have 
 	// all the events from the last playback position to the start of playback be fired.
-	if (EventName.IsEmpty() || !SweptRange.Contains(CurrentFrame) || Context.GetStatus() == EMovieScenePlayerStatus::Stopped || Context.IsSilent())
+	if (EventName.IsNone() || !SweptRange.Contains(CurrentFrame) || Context.GetStatus() == EMovieScenePlayerStatus::Stopped || Context.IsSilent())
 	{
 		return;
 	}
 
 	if ((!bBackwards && bFireEventsWhenForwards) || (bBackwards && bFireEventsWhenBackwards))
 	{
-		ExecutionTokens.Add(FFlowTrackExecutionToken({EventName}));
+		FFlowTrackEventNames EventsToTrigger;
+		EventsToTrigger.Add(EventName);
+		ExecutionTokens.Add(FFlowTrackExecutionToken(MoveTemp(EventsToTrigger)));
 	}
 }
 
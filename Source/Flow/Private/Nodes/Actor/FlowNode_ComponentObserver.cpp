@@ -72,6 +72,7 @@ void UFlowNode_ComponentObserver::StartObserving()
 		FlowSubsystem->OnComponentTagAdded.AddUniqueDynamic(this, &UFlowNode_ComponentObserver::OnComponentTagAdded);
 		FlowSubsystem->OnComponentTagRemoved.AddUniqueDynamic(this, &UFlowNode_ComponentObserver::OnComponentTagRemoved);
 		FlowSubsystem->OnComponentUnregistered.AddUniqueDynamic(this, &UFlowNode_ComponentObserver::OnComponentUnregistered);
+		FlowSubsystem->OnLevelComponentsUnregistered.AddUniqueDynamic(this, &UFlowNode_ComponentObserver::OnLevelComponentsUnregistered);
 	}
 }
 
@@ -81,6 +82,7 @@ void UFlowNode_ComponentObserver::StopObserving()
 	{
 		FlowSubsystem->OnComponentRegistered.RemoveAll(this);
 		FlowSubsystem->OnComponentUnregistered.RemoveAll(this);
+		FlowSubsystem->OnLevelComponentsUnregistered.RemoveAll(this);
 		FlowSubsystem->OnComponentTagAdded.RemoveAll(this);
 		FlowSubsystem->OnComponentTagRemoved.RemoveAll(this);
 	}
@@ -120,6 +122,22 @@ void UFlowNode_ComponentObserver::OnComponentUnregistered(UFlowComponent* Compon
 	}
 }
 
+void UFlowNode_ComponentObserver::OnLevelComponentsUnregistered(ULevel* Level, const TArray<UFlowComponent*>& Components)
+{
+	if (RegisteredActors.Num() == 0)
+	{
+		return;
+	}
+
+	for (UFlowComponent* Component : Components)
+	{
+		if (Component)
+		{
+			OnComponentUnregistered(Component);
+		}
+	}
+}
+
 void UFlowNode_ComponentObserver::OnEventReceived()
 {
 	TriggerFirstOutput(false);
@@ -9,6 +9,8 @@
 #include "FlowSettings.h"
 #include "Types/FlowInjectComponentsHelper.h"
 #include "Types/FlowInjectComponentsManager.h"
+#include "Types/FlowInjectComponentsPool.h"
+#include "Engine/World.h"
 #include "GameFramework/Actor.h"
 #include "Components/ActorComponent.h"
 
@@ -16,6 +18,25 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowNode_ExecuteComponent)
 
+//////////////////////////////////////////////////////////////////////////
+// FFlowExecuteComponentDispatch
+
+void FFlowExecuteComponentDispatch::Bind(UActorComponent& InComponent)
+{
+	Component = &InComponent;
+
+	NativeCoreExecutable = Cast<IFlowCoreExecutableInterface>(&InComponent);
+	NativeExternalExecutable = Cast<IFlowExternalExecutableInterface>(&InComponent);
+
+	bBlueprintCoreExecutable = !NativeCoreExecutable && InComponent.Implements<UFlowCoreExecutableInterface>();
+	bBlueprintExternalExecutable = !NativeExternalExecutable && InComponent.Implements<UFlowExternalExecutableInterface>();
+
+	bDataPinValueSupplier = Cast<IFlowDataPinValueSupplierInterface>(&InComponent) != nullptr;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// UFlowNode_ExecuteComponent
+
 UFlowNode_ExecuteComponent::UFlowNode_ExecuteComponent()
 	: Super()
 {
@@ -35,11 +56,11 @@ void UFlowNode_ExecuteComponent::InitializeInstance()
 
 	if (UActorComponent* ResolvedComp = TryResolveComponent())
 	{
-		if (IFlowCoreExecutableInterface* ComponentAsCoreExecutable = Cast<IFlowCoreExecutableInterface>(ResolvedComp))
+		if (IFlowCoreExecutableInterface* ComponentAsCoreExecutable = ComponentDispatch.NativeCoreExecutable)
 		{
 			ComponentAsCoreExecutable->InitializeInstance();
 		}
-		else if (ResolvedComp->Implements<UFlowCoreExecutableInterface>())
+		else if (ComponentDispatch.bBlueprintCoreExecutable)
 		{
 			IFlowCoreExecutableInterface::Execute_K2_InitializeInstance(ResolvedComp);
 		}
@@ -50,22 +71,27 @@ void UFlowNode_ExecuteComponent::DeinitializeInstance()
 {
 	if (UActorComponent* ResolvedComp = TryResolveComponent())
 	{
-		if (IFlowCoreExecutableInterface* ComponentAsCoreExecutable = Cast<IFlowCoreExecutableInterface>(ResolvedComp))
+		if (IFlowCoreExecutableInterface* ComponentAsCoreExecutable = ComponentDispatch.NativeCoreExecutable)
 		{
 			ComponentAsCoreExecutable->DeinitializeInstance();
 		}
-		else if (ResolvedComp->Implements<UFlowCoreExecutableInterface>())
+		else if (ComponentDispatch.bBlueprintCoreExecutable)
 		{
 			IFlowCoreExecutableInterface::Execute_K2_DeinitializeInstance(ResolvedComp);
 		}
 	}
 
+	ComponentDispatch.Reset();
+
 	if (EExecuteComponentSource_Classifiers::DoesComponentSourceUseInjectManager(ComponentSource))
 	{
 		if (IsValid(InjectComponentsManager))
 		{
 			InjectComponentsManager->ShutdownRuntime();
 		}
+
+		// Pooled component stays valid, it must not be resolved until injected again
+		ComponentRef.ClearResolvedComponent();
 	}
 
 	InjectComponentsManager = nullptr;
@@ -79,11 +105,11 @@ void UFlowNode_ExecuteComponent::PreloadContent()
 
 	if (UActorComponent* ResolvedComp = TryResolveComponent())
 	{
-		if (IFlowCoreExecutableInterface* ComponentAsCoreExecutable = Cast<IFlowCoreExecutableInterface>(ResolvedComp))
+		if (IFlowCoreExecutableInterface* ComponentAsCoreExecutable = ComponentDispatch.NativeCoreExecutable)
 		{
 			ComponentAsCoreExecutable->PreloadContent();
 		}
-		else if (ResolvedComp->Implements<UFlowCoreExecutableInterface>())
+		else if (ComponentDispatch.bBlueprintCoreExecutable)
 		{
 			IFlowCoreExecutableInterface::Execute_K2_PreloadContent(ResolvedComp);
 		}
@@ -94,11 +120,11 @@ void UFlowNode_ExecuteComponent::FlushContent()
 {
 	if (UActorComponent* ResolvedComp = TryResolveComponent())
 	{
-		if (IFlowCoreExecutableInterface* ComponentAsCoreExecutable = Cast<IFlowCoreExecutableInterface>(ResolvedComp))
+		if (IFlowCoreExecutableInterface* ComponentAsCoreExecutable = ComponentDispatch.NativeCoreExecutable)
 		{
 			ComponentAsCoreExecutable->FlushContent();
 		}
-		else if (ResolvedComp->Implements<UFlowCoreExecutableInterface>())
+		else if (ComponentDispatch.bBlueprintCoreExecutable)
 		{
 			IFlowCoreExecutableInterface::Execute_K2_FlushContent(ResolvedComp);
 		}
@@ -113,13 +139,13 @@ void UFlowNode_ExecuteComponent::OnActivate()
 
 	if (UActorComponent* ResolvedComp = TryResolveComponent())
 	{
-		if (IFlowExternalExecutableInterface* ComponentAsExternalExecutable = Cast<IFlowExternalExecutableInterface>(ResolvedComp))
+		if (IFlowExternalExecutableInterface* ComponentAsExternalExecutable = ComponentDispatch.NativeExternalExecutable)
 		{
 			// By convention, we must call the PreActivateExternalFlowExecutable() before OnActivate 
 			// when we (this node) are acting as the proxy for an IFlowExternalExecutableInterface object
 			ComponentAsExternalExecutable->PreActivateExternalFlowExecutable(*this);
 		}
-		else if (ResolvedComp->Implements<UFlowCoreExecutableInterface>())
+		else if (ComponentDispatch.bBlueprintExternalExecutable)
 		{
 			IFlowExternalExecutableInterface::Execute_K2_PreActivateExternalFlowExecutable(ResolvedComp, this);
 		}
@@ -128,11 +154,11 @@ void UFlowNode_ExecuteComponent::OnActivate()
 			UE_LOG(LogFlow, Error, TEXT("Expected a valid UActorComponent that implemented the IFlowExternalExecutableInterface"));
 		}
 
-		if (IFlowCoreExecutableInterface* ComponentAsCoreExecutable = Cast<IFlowCoreExecutableInterface>(ResolvedComp))
+		if (IFlowCoreExecutableInterface* ComponentAsCoreExecutable = ComponentDispatch.NativeCoreExecutable)
 		{
 			ComponentAsCoreExecutable->OnActivate();
 		}
-		else if (ResolvedComp->Implements<UFlowCoreExecutableInterface>())
+		else if (ComponentDispatch.bBlueprintCoreExecutable)
 		{
 			IFlowCoreExecutableInterface::Execute_K2_OnActivate(ResolvedComp);
 		}
@@ -147,11 +173,11 @@ void UFlowNode_ExecuteComponent::Cleanup()
 {
 	if (UActorComponent* ResolvedComp = TryResolveComponent())
 	{
-		if (IFlowCoreExecutableInterface* ComponentAsCoreExecutable = Cast<IFlowCoreExecutableInterface>(ResolvedComp))
+		if (IFlowCoreExecutableInterface* ComponentAsCoreExecutable = ComponentDispatch.NativeCoreExecutable)
 		{
 			ComponentAsCoreExecutable->Cleanup();
 		}
-		else if (ResolvedComp->Implements<UFlowCoreExecutableInterface>())
+		else if (ComponentDispatch.bBlueprintCoreExecutable)
 		{
 			IFlowCoreExecutableInterface::Execute_K2_Cleanup(ResolvedComp);
 		}
@@ -164,11 +190,11 @@ void UFlowNode_ExecuteComponent::ForceFinishNode()
 {
 	if (UActorComponent* ResolvedComp = TryResolveComponent())
 	{
-		if (IFlowCoreExecutableInterface* ComponentAsCoreExecutable = Cast<IFlowCoreExecutableInterface>(ResolvedComp))
+		if (IFlowCoreExecutableInterface* ComponentAsCoreExecutable = ComponentDispatch.NativeCoreExecutable)
 		{
 			ComponentAsCoreExecutable->ForceFinishNode();
 		}
-		else if (ResolvedComp->Implements<UFlowCoreExecutableInterface>())
+		else if (ComponentDispatch.bBlueprintCoreExecutable)
 		{
 			IFlowCoreExecutableInterface::Execute_K2_ForceFinishNode(ResolvedComp);
 		}
@@ -183,11 +209,11 @@ void UFlowNode_ExecuteComponent::ExecuteInput(const FName& PinName)
 
 	if (UActorComponent* ResolvedComp = TryResolveComponent())
 	{
-		if (IFlowCoreExecutableInterface* ComponentAsCoreExecutable = Cast<IFlowCoreExecutableInterface>(ResolvedComp))
+		if (IFlowCoreExecutableInterface* ComponentAsCoreExecutable = ComponentDispatch.NativeCoreExecutable)
 		{
 			ComponentAsCoreExecutable->ExecuteInput(PinName);
 		}
-		else if (ResolvedComp->Implements<UFlowCoreExecutableInterface>())
+		else if (ComponentDispatch.bBlueprintCoreExecutable)
 		{
 			IFlowCoreExecutableInterface::Execute_K2_ExecuteInput(ResolvedComp, PinName);
 		}
@@ -270,7 +296,7 @@ bool UFlowNode_ExecuteComponent::CanSupplyDataPinValues_Implementation() const
 {
 	if (UActorComponent* ResolvedComp = GetResolvedComponent())
 	{
-		if (IFlowDataPinValueSupplierInterface* PinSupplierInterface = Cast<IFlowDataPinValueSupplierInterface>(ResolvedComp))
+		if (ComponentDispatch.bDataPinValueSupplier)
 		{
 			if (IFlowDataPinValueSupplierInterface::Execute_CanSupplyDataPinValues(ResolvedComp))
 			{
@@ -286,7 +312,7 @@ FFlowDataPinResult_Bool UFlowNode_ExecuteComponent::TrySupplyDataPinAsBool_Imple
 {
 	if (UActorComponent* ResolvedComp = GetResolvedComponent())
 	{
-		if (IFlowDataPinValueSupplierInterface* PinSupplierInterface = Cast<IFlowDataPinValueSupplierInterface>(ResolvedComp))
+		if (ComponentDispatch.bDataPinValueSupplier)
 		{
 			const FFlowDataPinResult_Bool PinResult = IFlowDataPinValueSupplierInterface::Execute_TrySupplyDataPinAsBool(ResolvedComp, PinName);
 			if (PinResult.Result == EFlowDataPinResolveResult::Success)
@@ -303,7 +329,7 @@ FFlowDataPinResult_Int UFlowNode_ExecuteComponent::TrySupplyDataPinAsInt_Impleme
 {
 	if (UActorComponent* ResolvedComp = GetResolvedComponent())
 	{
-		if (IFlowDataPinValueSupplierInterface* PinSupplierInterface = Cast<IFlowDataPinValueSupplierInterface>(ResolvedComp))
+		if (ComponentDispatch.bDataPinValueSupplier)
 		{
 			const FFlowDataPinResult_Int PinResult = IFlowDataPinValueSupplierInterface::Execute_TrySupplyDataPinAsInt(ResolvedComp, PinName);
 			if (PinResult.Result == EFlowDataPinResolveResult::Success)
@@ -320,7 +346,7 @@ FFlowDataPinResult_Float UFlowNode_ExecuteComponent::TrySupplyDataPinAsFloat_Imp
 {
 	if (UActorComponent* ResolvedComp = GetResolvedComponent())
 	{
-		if (IFlowDataPinValueSupplierInterface* PinSupplierInterface = Cast<IFlowDataPinValueSupplierInterface>(ResolvedComp))
+		if (ComponentDispatch.bDataPinValueSupplier)
 		{
 			const FFlowDataPinResult_Float PinResult = IFlowDataPinValueSupplierInterface::Execute_TrySupplyDataPinAsFloat(ResolvedComp, PinName);
 			if (PinResult.Result == EFlowDataPinResolveResult::Success)
@@ -337,7 +363,7 @@ FFlowDataPinResult_Name UFlowNode_ExecuteComponent::TrySupplyDataPinAsName_Imple
 {
 	if (UActorComponent* ResolvedComp = GetResolvedComponent())
 	{
-		if (IFlowDataPinValueSupplierInterface* PinSupplierInterface = Cast<IFlowDataPinValueSupplierInterface>(ResolvedComp))
+		if (ComponentDispatch.bDataPinValueSupplier)
 		{
 			const FFlowDataPinResult_Name PinResult = IFlowDataPinValueSupplierInterface::Execute_TrySupplyDataPinAsName(ResolvedComp, PinName);
 			if (PinResult.Result == EFlowDataPinResolveResult::Success)
@@ -354,7 +380,7 @@ FFlowDataPinResult_String UFlowNode_ExecuteComponent::TrySupplyDataPinAsString_I
 {
 	if (UActorComponent* ResolvedComp = GetResolvedComponent())
 	{
-		if (IFlowDataPinValueSupplierInterface* PinSupplierInterface = Cast<IFlowDataPinValueSupplierInterface>(ResolvedComp))
+		if (ComponentDispatch.bDataPinValueSupplier)
 		{
 			const FFlowDataPinResult_String PinResult = IFlowDataPinValueSupplierInterface::Execute_TrySupplyDataPinAsString(ResolvedComp, PinName);
 			if (PinResult.Result == EFlowDataPinResolveResult::Success)
@@ -371,7 +397,7 @@ FFlowDataPinResult_Text UFlowNode_ExecuteComponent::TrySupplyDataPinAsText_Imple
 {
 	if (UActorComponent* ResolvedComp = GetResolvedComponent())
 	{
-		if (IFlowDataPinValueSupplierInterface* PinSupplierInterface = Cast<IFlowDataPinValueSupplierInterface>(ResolvedComp))
+		if (ComponentDispatch.bDataPinValueSupplier)
 		{
 			const FFlowDataPinResult_Text PinResult = IFlowDataPinValueSupplierInterface::Execute_TrySupplyDataPinAsText(ResolvedComp, PinName);
 			if (PinResult.Result == EFlowDataPinResolveResult::Success)
@@ -388,7 +414,7 @@ FFlowDataPinResult_Enum UFlowNode_ExecuteComponent::TrySupplyDataPinAsEnum_Imple
 {
 	if (UActorComponent* ResolvedComp = GetResolvedComponent())
 	{
-		if (IFlowDataPinValueSupplierInterface* PinSupplierInterface = Cast<IFlowDataPinValueSupplierInterface>(ResolvedComp))
+		if (ComponentDispatch.bDataPinValueSupplier)
 		{
 			const FFlowDataPinResult_Enum PinResult = IFlowDataPinValueSupplierInterface::Execute_TrySupplyDataPinAsEnum(ResolvedComp, PinName);
 			if (PinResult.Result == EFlowDataPinResolveResult::Success)
@@ -405,7 +431,7 @@ FFlowDataPinResult_Vector UFlowNode_ExecuteComponent::TrySupplyDataPinAsVector_I
 {
 	if (UActorComponent* ResolvedComp = GetResolvedComponent())
 	{
-		if (IFlowDataPinValueSupplierInterface* PinSupplierInterface = Cast<IFlowDataPinValueSupplierInterface>(ResolvedComp))
+		if (ComponentDispatch.bDataPinValueSupplier)
 		{
 			const FFlowDataPinResult_Vector PinResult = IFlowDataPinValueSupplierInterface::Execute_TrySupplyDataPinAsVector(ResolvedComp, PinName);
 			if (PinResult.Result == EFlowDataPinResolveResult::Success)
@@ -422,7 +448,7 @@ FFlowDataPinResult_Rotator UFlowNode_ExecuteComponent::TrySupplyDataPinAsRotator
 {
 	if (UActorComponent* ResolvedComp = GetResolvedComponent())
 	{
-		if (IFlowDataPinValueSupplierInterface* PinSupplierInterface = Cast<IFlowDataPinValueSupplierInterface>(ResolvedComp))
+		if (ComponentDispatch.bDataPinValueSupplier)
 		{
 			const FFlowDataPinResult_Rotator PinResult = IFlowDataPinValueSupplierInterface::Execute_TrySupplyDataPinAsRotator(ResolvedComp, PinName);
 			if (PinResult.Result == EFlowDataPinResolveResult::Success)
@@ -439,7 +465,7 @@ FFlowDataPinResult_Transform UFlowNode_ExecuteComponent::TrySupplyDataPinAsTrans
 {
 	if (UActorComponent* ResolvedComp = GetResolvedComponent())
 	{
-		if (IFlowDataPinValueSupplierInterface* PinSupplierInterface = Cast<IFlowDataPinValueSupplierInterface>(ResolvedComp))
+		if (ComponentDispatch.bDataPinValueSupplier)
 		{
 			const FFlowDataPinResult_Transform PinResult = IFlowDataPinValueSupplierInterface::Execute_TrySupplyDataPinAsTransform(ResolvedComp, PinName);
 			if (PinResult.Result == EFlowDataPinResolveResult::Success)
@@ -456,7 +482,7 @@ FFlowDataPinResult_GameplayTag UFlowNode_ExecuteComponent::TrySupplyDataPinAsGam
 {
 	if (UActorComponent* ResolvedComp = GetResolvedComponent())
 	{
-		if (IFlowDataPinValueSupplierInterface* PinSupplierInterface = Cast<IFlowDataPinValueSupplierInterface>(ResolvedComp))
+		if (ComponentDispatch.bDataPinValueSupplier)
 		{
 			const FFlowDataPinResult_GameplayTag PinResult = IFlowDataPinValueSupplierInterface::Execute_TrySupplyDataPinAsGameplayTag(ResolvedComp, PinName);
 			if (PinResult.Result == EFlowDataPinResolveResult::Success)
@@ -473,7 +499,7 @@ FFlowDataPinResult_GameplayTagContainer UFlowNode_ExecuteComponent::TrySupplyDat
 {
 	if (UActorComponent* ResolvedComp = GetResolvedComponent())
 	{
-		if (IFlowDataPinValueSupplierInterface* PinSupplierInterface = Cast<IFlowDataPinValueSupplierInterface>(ResolvedComp))
+		if (ComponentDispatch.bDataPinValueSupplier)
 		{
 			const FFlowDataPinResult_GameplayTagContainer PinResult = IFlowDataPinValueSupplierInterface::Execute_TrySupplyDataPinAsGameplayTagContainer(ResolvedComp, PinName);
 			if (PinResult.Result == EFlowDataPinResolveResult::Success)
@@ -490,7 +516,7 @@ FFlowDataPinResult_InstancedStruct UFlowNode_ExecuteComponent::TrySupplyDataPinA
 {
 	if (UActorComponent* ResolvedComp = GetResolvedComponent())
 	{
-		if (IFlowDataPinValueSupplierInterface* PinSupplierInterface = Cast<IFlowDataPinValueSupplierInterface>(ResolvedComp))
+		if (ComponentDispatch.bDataPinValueSupplier)
 		{
 			const FFlowDataPinResult_InstancedStruct PinResult = IFlowDataPinValueSupplierInterface::Execute_TrySupplyDataPinAsInstancedStruct(ResolvedComp, PinName);
 			if (PinResult.Result == EFlowDataPinResolveResult::Success)
@@ -507,7 +533,7 @@ FFlowDataPinResult_Object UFlowNode_ExecuteComponent::TrySupplyDataPinAsObject_I
 {
 	if (UActorComponent* ResolvedComp = GetResolvedComponent())
 	{
-		if (IFlowDataPinValueSupplierInterface* PinSupplierInterface = Cast<IFlowDataPinValueSupplierInterface>(ResolvedComp))
+		if (ComponentDispatch.bDataPinValueSupplier)
 		{
 			const FFlowDataPinResult_Object PinResult = IFlowDataPinValueSupplierInterface::Execute_TrySupplyDataPinAsObject(ResolvedComp, PinName);
 			if (PinResult.Result == EFlowDataPinResolveResult::Success)
@@ -524,7 +550,7 @@ FFlowDataPinResult_Class UFlowNode_ExecuteComponent::TrySupplyDataPinAsClass_Imp
 {
 	if (UActorComponent* ResolvedComp = GetResolvedComponent())
 	{
-		if (IFlowDataPinValueSupplierInterface* PinSupplierInterface = Cast<IFlowDataPinValueSupplierInterface>(ResolvedComp))
+		if (ComponentDispatch.bDataPinValueSupplier)
 		{
 			const FFlowDataPinResult_Class PinResult = IFlowDataPinValueSupplierInterface::Execute_TrySupplyDataPinAsClass(ResolvedComp, PinName);
 			if (PinResult.Result == EFlowDataPinResolveResult::Success)
@@ -550,6 +576,10 @@ bool UFlowNode_ExecuteComponent::TryInjectComponent()
 		return false;
 	}
 
+	// other nodes might have pooled components on this actor, even if this node doesn't pool its component
+	UFlowInjectComponentsPool* WorldComponentsPool = UWorld::GetSubsystem<UFlowInjectComponentsPool>(ActorOwner->GetWorld());
+	UFlowInjectComponentsPool* ComponentsPool = bPoolInjectedComponent ? WorldComponentsPool : nullptr;
+
 	// Create the component instance
 	TArray<UActorComponent*> ComponentInstances;
 	
@@ -561,7 +591,11 @@ bool UFlowNode_ExecuteComponent::TryInjectComponent()
 		{
 			if (IsValid(ComponentTemplate))
 			{
-				if (UActorComponent* ComponentInstance = FFlowInjectComponentsHelper::TryCreateComponentInstanceForActorFromTemplate(*ActorOwner, *ComponentTemplate))
+				if (UActorComponent* PooledInstance = ComponentsPool ? ComponentsPool->TryAcquireComponent(*ActorOwner, *ComponentTemplate->GetClass(), ComponentTemplate) : nullptr)
+				{
+					ComponentInstances.Add(PooledInstance);
+				}
+				else if (UActorComponent* ComponentInstance = FFlowInjectComponentsHelper::TryCreateComponentInstanceForActorFromTemplate(*ActorOwner, *ComponentTemplate))
 				{
 					ComponentInstances.Add(ComponentInstance);
 				}
@@ -577,8 +611,18 @@ bool UFlowNode_ExecuteComponent::TryInjectComponent()
 				{
 					// Look for the component class existing already on the actor, for potential re-use
 
-					UActorComponent* ExistingComponent = ActorOwner->FindComponentByClass(ComponentClass);
-					if (IsValid(ExistingComponent))
+					// Pooled components are picked up from the pool below
+					UActorComponent* ExistingComponent = nullptr;
+					for (UActorComponent* Component : ActorOwner->GetComponents())
+					{
+						if (IsValid(Component) && Component->IsA(ComponentClass) && !(WorldComponentsPool && WorldComponentsPool->IsPooled(*Component)))
+						{
+							ExistingComponent = Component;
+							break;
+						}
+					}
+
+					if (ExistingComponent)
 					{
 						// Set the ComponentRef directly (for later lookup via TryResolveComponent)
 						ComponentRef.SetResolvedComponentDirect(*ExistingComponent);
@@ -593,7 +637,11 @@ bool UFlowNode_ExecuteComponent::TryInjectComponent()
 				}
 
 				const FName InstanceBaseName = ComponentClass->GetFName();
-				if (UActorComponent* ComponentInstance = FFlowInjectComponentsHelper::TryCreateComponentInstanceForActorFromClass(*ActorOwner, *ComponentClass, InstanceBaseName))
+				if (UActorComponent* PooledInstance = ComponentsPool ? ComponentsPool->TryAcquireComponent(*ActorOwner, *ComponentClass, nullptr) : nullptr)
+				{
+					ComponentInstances.Add(PooledInstance);
+				}
+				else if (UActorComponent* ComponentInstance = FFlowInjectComponentsHelper::TryCreateComponentInstanceForActorFromClass(*ActorOwner, *ComponentClass, InstanceBaseName))
 				{
 					ComponentInstances.Add(ComponentInstance);
 				}
@@ -608,6 +656,7 @@ bool UFlowNode_ExecuteComponent::TryInjectComponent()
 
 	// Create the manager object if we're injecting a component
 	InjectComponentsManager = NewObject<UFlowInjectComponentsManager>(this);
+	InjectComponentsManager->bReturnComponentsToPool = bPoolInjectedComponent;
 	InjectComponentsManager->InitializeRuntime();
 
 	// Inject the desired component
@@ -629,6 +678,11 @@ UActorComponent* UFlowNode_ExecuteComponent::TryResolveComponent()
 	UActorComponent* ResolvedComp = ComponentRef.GetResolvedComponent();
 	if (IsValid(ResolvedComp))
 	{
+		if (!ComponentDispatch.IsBoundTo(*ResolvedComp))
+		{
+			ComponentDispatch.Bind(*ResolvedComp);
+		}
+
 		return ResolvedComp;
 	}
 
@@ -645,6 +699,15 @@ UActorComponent* UFlowNode_ExecuteComponent::TryResolveComponent()
 	constexpr bool bAllowWarnIfFailed = true;
 	ResolvedComp = ComponentRef.TryResolveComponent(*ActorOwner, bAllowWarnIfFailed);
 
+	if (IsValid(ResolvedComp))
+	{
+		ComponentDispatch.Bind(*ResolvedComp);
+	}
+	else
+	{
+		ComponentDispatch.Reset();
+	}
+
 	return ResolvedComp;
 }
 
@@ -655,6 +718,11 @@ UActorComponent* UFlowNode_ExecuteComponent::GetResolvedComponent() const
 	UActorComponent* ResolvedComp = ComponentRef.GetResolvedComponent();
 	if (IsValid(ResolvedComp))
 	{
+		if (!ComponentDispatch.IsBoundTo(*ResolvedComp))
+		{
+			ComponentDispatch.Bind(*ResolvedComp);
+		}
+
 		return ResolvedComp;
 	}
 
@@ -6,14 +6,17 @@
 #include "FlowLogChannels.h"
 #include "FlowSubsystem.h"
 #include "LevelSequence/FlowLevelSequencePlayer.h"
+#include "LevelSequence/FlowLevelSequencePool.h"
 
 #if WITH_EDITOR
 #include "MovieScene/MovieSceneFlowTrack.h"
 #include "MovieScene/MovieSceneFlowTriggerSection.h"
 #endif
 
+#include "Engine/World.h"
 #include "LevelSequence.h"
 #include "LevelSequenceActor.h"
+#include "TimerManager.h"
 #include "VisualLogger/VisualLogger.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowNode_PlayLevelSequence)
@@ -24,12 +27,14 @@ FFlowNodeLevelSequenceEvent UFlowNode_PlayLevelSequence::OnPlaybackCompleted;
 UFlowNode_PlayLevelSequence::UFlowNode_PlayLevelSequence(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, bPlayReverse(false)
+	, LoadTimeout(0.0f)
 	, bUseGraphOwnerAsTransformOrigin(false)
 	, bReplicates(false)
 	, bAlwaysRelevant(false)
 	, bApplyOwnerTimeDilation(true)
 	, LoadedSequence(nullptr)
 	, SequencePlayer(nullptr)
+	, SequenceActor(nullptr)
 	, CachedPlayRate(0)
 	, StartTime(0.0f)
 	, ElapsedTime(0.0f)
@@ -50,6 +55,7 @@ UFlowNode_PlayLevelSequence::UFlowNode_PlayLevelSequence(const FObjectInitialize
 	OutputPins.Add(FFlowPin(TEXT("Started")));
 	OutputPins.Add(FFlowPin(TEXT("Completed")));
 	OutputPins.Add(FFlowPin(TEXT("Stopped")));
+	OutputPins.Add(FFlowPin(TEXT("TimedOut")));
 }
 
 #if WITH_EDITOR
@@ -134,10 +140,10 @@ void UFlowNode_PlayLevelSequence::InitializeInstance()
 
 void UFlowNode_PlayLevelSequence::CreatePlayer()
 {
-	LoadedSequence = Sequence.LoadSynchronous();
+	LoadedSequence = Sequence.Get();
 	if (LoadedSequence)
 	{
-		ALevelSequenceActor* SequenceActor;
+		ALevelSequenceActor* NewSequenceActor = nullptr;
 
 		AActor* OwningActor = TryGetRootFlowActorOwner();
 
@@ -150,8 +156,16 @@ void UFlowNode_PlayLevelSequence::CreatePlayer()
 		// Apply Transform Origin
 		AActor* TransformOriginActor = bUseGraphOwnerAsTransformOrigin ? OwningActor : nullptr;
 
-		// Finally create the player
-		SequencePlayer = UFlowLevelSequencePlayer::CreateFlowLevelSequencePlayer(this, LoadedSequence, PlaybackSettings, CameraSettings, TransformOriginActor, bReplicates, bAlwaysRelevant, SequenceActor);
+		// Finally borrow the player from the pool, or create a new one
+		if (UFlowLevelSequencePool* SequencePool = UWorld::GetSubsystem<UFlowLevelSequencePool>(GetWorld()))
+		{
+			SequencePlayer = SequencePool->AcquirePlayer(LoadedSequence, PlaybackSettings, CameraSettings, TransformOriginActor, bReplicates, bAlwaysRelevant, NewSequenceActor);
+		}
+		else
+		{
+			SequencePlayer = UFlowLevelSequencePlayer::CreateFlowLevelSequencePlayer(this, LoadedSequence, PlaybackSettings, CameraSettings, TransformOriginActor, bReplicates, bAlwaysRelevant, NewSequenceActor);
+		}
+		SequenceActor = NewSequenceActor;
 
 		if (SequencePlayer)
 		{
@@ -168,32 +182,14 @@ void UFlowNode_PlayLevelSequence::ExecuteInput(const FName& PinName)
 {
 	if (PinName == TEXT("Start"))
 	{
-		LoadedSequence = Sequence.LoadSynchronous();
-
-		if (GetFlowSubsystem()->GetWorld() && LoadedSequence)
+		if (Sequence.IsNull() || Sequence.Get())
 		{
-			CreatePlayer();
-
-			if (SequencePlayer)
-			{
-				TriggerOutput(TEXT("PreStart"));
-
-				SequencePlayer->OnFinished.AddDynamic(this, &UFlowNode_PlayLevelSequence::OnPlaybackFinished);
-
-				if (bPlayReverse)
-				{
-					SequencePlayer->PlayReverse();
-				}
-				else
-				{
-					SequencePlayer->Play();
-				}
-
-				TriggerOutput(TEXT("Started"));
-			}
+			StartPlayback();
+		}
+		else
+		{
+			RequestSequenceLoad(false);
 		}
-
-		TriggerFirstOutput(false);
 	}
 	else if (PinName == TEXT("Stop"))
 	{
@@ -201,14 +197,107 @@ void UFlowNode_PlayLevelSequence::ExecuteInput(const FName& PinName)
 	}
 	else if (PinName == TEXT("Pause"))
 	{
-		SequencePlayer->Pause();
+		if (SequencePlayer)
+		{
+			SequencePlayer->Pause();
+		}
 	}
-	else if (PinName == TEXT("Resume") && SequencePlayer->IsPaused())
+	else if (PinName == TEXT("Resume") && SequencePlayer && SequencePlayer->IsPaused())
 	{
 		SequencePlayer->Play();
 	}
 }
 
+void UFlowNode_PlayLevelSequence::RequestSequenceLoad(const bool bResumePlayback)
+{
+#if ENABLE_VISUAL_LOG
+	UE_VLOG(this, LogFlow, Log, TEXT("Loading sequence asynchronously: %s"), *Sequence.ToString());
+#endif
+
+	CancelSequenceLoad();
+
+	// timeout applies only to Start, playback restored from SaveGame should always be resumed
+	if (!bResumePlayback && LoadTimeout > 0.0f && GetWorld())
+	{
+		GetWorld()->GetTimerManager().SetTimer(LoadTimeoutTimerHandle, this, &UFlowNode_PlayLevelSequence::OnSequenceLoadTimeout, LoadTimeout, false);
+	}
+
+	// delegate might be executed instantly, if the asset is already loaded
+	SequenceLoadHandle = StreamableManager.RequestAsyncLoad(Sequence.ToSoftObjectPath(), FStreamableDelegate::CreateUObject(this, &UFlowNode_PlayLevelSequence::OnSequenceLoaded, bResumePlayback));
+}
+
+void UFlowNode_PlayLevelSequence::OnSequenceLoaded(const bool bResumePlayback)
+{
+	if (GetWorld())
+	{
+		GetWorld()->GetTimerManager().ClearTimer(LoadTimeoutTimerHandle);
+	}
+	SequenceLoadHandle.Reset();
+
+	if (bResumePlayback)
+	{
+		ResumePlayback();
+	}
+	else
+	{
+		StartPlayback();
+	}
+}
+
+void UFlowNode_PlayLevelSequence::OnSequenceLoadTimeout()
+{
+	LogWarning(FString::Printf(TEXT("Loading sequence %s took longer than %.2f seconds"), *Sequence.ToString(), LoadTimeout));
+
+	CancelSequenceLoad();
+
+	TriggerFirstOutput(false);
+	TriggerOutput(TEXT("TimedOut"), true);
+}
+
+void UFlowNode_PlayLevelSequence::CancelSequenceLoad()
+{
+	if (SequenceLoadHandle.IsValid())
+	{
+		SequenceLoadHandle->CancelHandle();
+		SequenceLoadHandle.Reset();
+	}
+
+	if (GetWorld())
+	{
+		GetWorld()->GetTimerManager().ClearTimer(LoadTimeoutTimerHandle);
+	}
+}
+
+void UFlowNode_PlayLevelSequence::StartPlayback()
+{
+	LoadedSequence = Sequence.Get();
+
+	if (GetFlowSubsystem()->GetWorld() && LoadedSequence)
+	{
+		CreatePlayer();
+
+		if (SequencePlayer)
+		{
+			TriggerOutput(TEXT("PreStart"));
+
+			SequencePlayer->OnFinished.AddDynamic(this, &UFlowNode_PlayLevelSequence::OnPlaybackFinished);
+
+			if (bPlayReverse)
+			{
+				SequencePlayer->PlayReverse();
+			}
+			else
+			{
+				SequencePlayer->Play();
+			}
+
+			TriggerOutput(TEXT("Started"));
+		}
+	}
+
+	TriggerFirstOutput(false);
+}
+
 void UFlowNode_PlayLevelSequence::OnSave_Implementation()
 {
 	if (SequencePlayer)
@@ -219,38 +308,51 @@ void UFlowNode_PlayLevelSequence::OnSave_Implementation()
 
 void UFlowNode_PlayLevelSequence::OnLoad_Implementation()
 {
-	if (ElapsedTime != 0.0f)
+	if (ElapsedTime != 0.0f && !Sequence.IsNull())
 	{
-		LoadedSequence = Sequence.LoadSynchronous();
-		if (GetFlowSubsystem()->GetWorld() && LoadedSequence)
+		if (Sequence.Get())
 		{
-			CreatePlayer();
+			ResumePlayback();
+		}
+		else
+		{
+			RequestSequenceLoad(true);
+		}
+	}
+}
 
-			if (SequencePlayer)
-			{
-				SequencePlayer->OnFinished.AddDynamic(this, &UFlowNode_PlayLevelSequence::OnPlaybackFinished);
+void UFlowNode_PlayLevelSequence::ResumePlayback()
+{
+	LoadedSequence = Sequence.Get();
 
-				SequencePlayer->SetPlaybackPosition(FMovieSceneSequencePlaybackParams(ElapsedTime, EUpdatePositionMethod::Jump));
+	if (GetFlowSubsystem()->GetWorld() && LoadedSequence)
+	{
+		CreatePlayer();
 
-				// Take into account Play Rate set in the Playback Settings
-				SequencePlayer->SetPlayRate(TimeDilation * CachedPlayRate);
+		if (SequencePlayer)
+		{
+			SequencePlayer->OnFinished.AddDynamic(this, &UFlowNode_PlayLevelSequence::OnPlaybackFinished);
 
-				if (bPlayReverse)
-				{
-					SequencePlayer->PlayReverse();
-				}
-				else
-				{
-					SequencePlayer->Play();
-				}
+			SequencePlayer->SetPlaybackPosition(FMovieSceneSequencePlaybackParams(ElapsedTime, EUpdatePositionMethod::Jump));
+
+			// Take into account Play Rate set in the Playback Settings
+			SequencePlayer->SetPlayRate(TimeDilation * CachedPlayRate);
+
+			if (bPlayReverse)
+			{
+				SequencePlayer->PlayReverse();
+			}
+			else
+			{
+				SequencePlayer->Play();
 			}
 		}
 	}
 }
 
-void UFlowNode_PlayLevelSequence::TriggerEvent(const FString& EventName)
+void UFlowNode_PlayLevelSequence::TriggerEvent(const FName& EventName)
 {
-	TriggerOutput(*EventName, false);
+	TriggerOutput(EventName, false);
 }
 
 void UFlowNode_PlayLevelSequence::OnTimeDilationUpdate(const float NewTimeDilation)
@@ -281,6 +383,8 @@ void UFlowNode_PlayLevelSequence::StopPlayback()
 
 void UFlowNode_PlayLevelSequence::Cleanup()
 {
+	CancelSequenceLoad();
+
 	if (SequencePlayer)
 	{
 		SequencePlayer->SetFlowEventReceiver(nullptr);
@@ -288,9 +392,16 @@ void UFlowNode_PlayLevelSequence::Cleanup()
 		if (!PlaybackSettings.bPauseAtEnd)
 		{
 			SequencePlayer->Stop();
+
+			// actor paused at the end keeps its evaluated state, so it can't be reused
+			if (UFlowLevelSequencePool* SequencePool = UWorld::GetSubsystem<UFlowLevelSequencePool>(GetWorld()))
+			{
+				SequencePool->ReleasePlayer(SequenceActor);
+			}
 		}
 		SequencePlayer = nullptr;
 	}
+	SequenceActor = nullptr;
 
 	LoadedSequence = nullptr;
 	StartTime = 0.0f;
@@ -5,6 +5,7 @@
 
 #include "FlowAsset.h"
 #include "FlowSettings.h"
+#include "FlowStats.h"
 #include "Interfaces/FlowNodeWithExternalDataPinSupplierInterface.h"
 #include "Types/FlowDataPinProperties.h"
 
@@ -16,6 +17,7 @@
 #include "Engine/BlueprintGeneratedClass.h"
 #include "GameFramework/Actor.h"
 #include "Misc/App.h"
+#include "Serialization/ArchiveCountMem.h"
 #include "Serialization/MemoryReader.h"
 #include "Serialization/MemoryWriter.h"
 
@@ -800,8 +802,17 @@ void UFlowNode::TriggerInput(const FName& PinName, const EFlowPinActivationType
 			}
 
 			ActivationState = EFlowNodeState::Active;
+
+			if (PreviousActivationState != EFlowNodeState::Active)
+			{
+				GetFlowAsset()->OnNodeActivationStateChanged(*this);
+				FFlowStats::OnNodeActivated();
+				TRACE_FLOW_NODE_ACTIVATED(*this);
+			}
 		}
 
+		TRACE_FLOW_PIN_TRIGGERED(*this, PinName, true);
+
 #if !UE_BUILD_SHIPPING
 		// record for debugging
 		TArray<FPinRecord>& Records = InputRecords.FindOrAdd(PinName);
@@ -884,6 +895,8 @@ void UFlowNode::TriggerOutput(const FName PinName, const bool bFinish /*= false*
 	}
 #endif
 
+	TRACE_FLOW_PIN_TRIGGERED(*this, PinName, false);
+
 	// call the next node
 	if (OutputPins.Contains(PinName) && Connections.Contains(PinName))
 	{
@@ -906,6 +919,11 @@ void UFlowNode::Deactivate()
 		return;
 	}
 
+	if (ActivationState == EFlowNodeState::Active)
+	{
+		FFlowStats::OnNodeDeactivated();
+	}
+
 	if (GetFlowAsset()->FinishPolicy == EFlowFinishPolicy::Abort)
 	{
 		ActivationState = EFlowNodeState::Aborted;
@@ -915,12 +933,24 @@ void UFlowNode::Deactivate()
 		ActivationState = EFlowNodeState::Completed;
 	}
 
+	GetFlowAsset()->OnNodeActivationStateChanged(*this);
+	TRACE_FLOW_NODE_FINISHED(*this);
+
 	Cleanup();
 }
 
 void UFlowNode::ResetRecords()
 {
-	ActivationState = EFlowNodeState::NeverActivated;
+	if (ActivationState != EFlowNodeState::NeverActivated)
+	{
+		if (ActivationState == EFlowNodeState::Active)
+		{
+			FFlowStats::OnNodeDeactivated();
+		}
+
+		ActivationState = EFlowNodeState::NeverActivated;
+		GetFlowAsset()->OnNodeActivationStateChanged(*this);
+	}
 
 #if !UE_BUILD_SHIPPING
 	InputRecords.Empty();
@@ -940,10 +970,22 @@ void UFlowNode::SaveInstance(FFlowNodeSaveData& NodeRecord)
 
 void UFlowNode::LoadInstance(const FFlowNodeSaveData& NodeRecord)
 {
+	const EFlowNodeState PreviousActivationState = ActivationState;
+
 	FMemoryReader MemoryReader(NodeRecord.NodeData, true);
 	FFlowArchive Ar(MemoryReader);
 	Serialize(Ar);
 
+	// keep "stat flow" counters in sync, ActivationState was restored without activating the node
+	if (ActivationState == EFlowNodeState::Active && PreviousActivationState != EFlowNodeState::Active)
+	{
+		FFlowStats::OnNodeRestored();
+	}
+	else if (ActivationState != EFlowNodeState::Active && PreviousActivationState == EFlowNodeState::Active)
+	{
+		FFlowStats::OnNodeDeactivated();
+	}
+
 	if (UFlowAsset* FlowAsset = GetFlowAsset())
 	{
 		FlowAsset->OnActivationStateLoaded(this);
@@ -1017,6 +1059,73 @@ TArray<FPinRecord> UFlowNode::GetPinRecords(const FName& PinName, const EEdGraph
 
 #endif
 
+#if !UE_BUILD_SHIPPING
+void UFlowNode::GetMemoryFootprint(FFlowMemoryFootprint& OutFootprint) const
+{
+	auto GetPinsBytes = [](const TArray<FFlowPin>& Pins)
+	{
+		SIZE_T Bytes = Pins.GetAllocatedSize();
+#if WITH_EDITORONLY_DATA
+		for (const FFlowPin& Pin : Pins)
+		{
+			Bytes += Pin.PinToolTip.GetAllocatedSize();
+		}
+#endif
+		return Bytes;
+	};
+
+	auto GetRecordsBytes = [](const TMap<FName, TArray<FPinRecord>>& Records)
+	{
+		SIZE_T Bytes = Records.GetAllocatedSize();
+		for (const TPair<FName, TArray<FPinRecord>>& Record : Records)
+		{
+			Bytes += Record.Value.GetAllocatedSize();
+			for (const FPinRecord& PinRecord : Record.Value)
+			{
+				Bytes += PinRecord.HumanReadableTime.GetAllocatedSize();
+			}
+		}
+		return Bytes;
+	};
+
+	const SIZE_T PinsBytes = GetPinsBytes(InputPins) + GetPinsBytes(OutputPins);
+	const SIZE_T ConnectionsBytes = Connections.GetAllocatedSize();
+
+	SIZE_T DataPinBytes = PinNameToBoundPropertyNameMap.GetAllocatedSize();
+	for (TFieldIterator<FStructProperty> PropertyIt(GetClass()); PropertyIt; ++PropertyIt)
+	{
+		if (PropertyIt->Struct->IsChildOf(FFlowDataPinProperty::StaticStruct()))
+		{
+			// inline size of the property, plus heap allocations counted while serializing its value
+			FArchiveCountMem CountMem(nullptr);
+			PropertyIt->Struct->SerializeBin(CountMem, PropertyIt->ContainerPtrToValuePtr<void>(const_cast<UFlowNode*>(this)));
+			DataPinBytes += PropertyIt->GetSize() + CountMem.GetMax();
+		}
+	}
+
+	// pins, connections and data pins are properties of this node, already included in the object size
+	const SIZE_T NodeBytes = FFlowMemoryFootprint::GetObjectBytes(this);
+	const SIZE_T AttributedBytes = PinsBytes + ConnectionsBytes + DataPinBytes;
+
+	OutFootprint.NodeObjects += NodeBytes > AttributedBytes ? NodeBytes - AttributedBytes : 0;
+	OutFootprint.Pins += PinsBytes;
+	OutFootprint.Connections += ConnectionsBytes;
+	OutFootprint.DataPinPayloads += DataPinBytes;
+	OutFootprint.PinRecords += GetRecordsBytes(InputRecords) + GetRecordsBytes(OutputRecords);
+
+	// add-ons might own further add-ons
+	TArray<const UFlowNodeAddOn*> AddOnsToVisit(GetFlowNodeAddOnChildren());
+	while (AddOnsToVisit.Num() > 0)
+	{
+		if (const UFlowNodeAddOn* AddOn = AddOnsToVisit.Pop())
+		{
+			OutFootprint.AddOns += FFlowMemoryFootprint::GetObjectBytes(AddOn);
+			AddOnsToVisit.Append(AddOn->GetFlowNodeAddOnChildren());
+		}
+	}
+}
+#endif
+
 FString UFlowNode::GetIdentityTagDescription(const FGameplayTag& Tag)
 {
 	return Tag.IsValid() ? Tag.ToString() : MissingIdentityTag;
@@ -1058,7 +1167,7 @@ FString UFlowNode::GetStatusStringForNodeAndAddOns() const
 	FString CombinedStatusString = GetStatusString();
 
 	// Give all of the AddOns a chance to add their status strings as well
-	(void)ForEachAddOnConst(
+	(void)ForEachAddOnConstInline(
 		[&CombinedStatusString](const UFlowNodeAddOn& AddOn)
 		{
 			const FString AddOnStatusString = AddOn.GetStatusString();
@@ -5,6 +5,7 @@
 #include "AddOns/FlowNodeAddOn.h"
 #include "FlowAsset.h"
 #include "FlowLogChannels.h"
+#include "FlowStats.h"
 #include "FlowSubsystem.h"
 #include "FlowTypes.h"
 #include "Interfaces/FlowDataPinValueSupplierInterface.h"
@@ -27,8 +28,6 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowNodeBase)
 
-using namespace EFlowForEachAddOnFunctionReturnValue_Classifiers;
-
 UFlowNodeBase::UFlowNodeBase(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 #if WITH_EDITORONLY_DATA
@@ -90,6 +89,8 @@ void UFlowNodeBase::InitializeInstance()
 			// Initialize all the AddOn instances after they are all allocated
 			AddOn->InitializeInstance();
 		}
+
+		BuildFlattenedAddOns();
 	}
 }
 
@@ -100,6 +101,8 @@ void UFlowNodeBase::DeinitializeInstance()
 		AddOn->DeinitializeInstance();
 	}
 
+	FlattenedAddOns.Reset();
+
 	IFlowCoreExecutableInterface::DeinitializeInstance();
 }
 
@@ -135,19 +138,30 @@ void UFlowNodeBase::OnActivate()
 
 void UFlowNodeBase::ExecuteInputForSelfAndAddOns(const FName& PinName)
 {
+	SCOPE_CYCLE_COUNTER(STAT_FlowExecuteInput);
+
 	// AddOns can introduce input pins to Nodes without the Node being aware of the addition.
 	// To ensure that Nodes and AddOns only get the input pins signalled that they expect,
 	// we are filtering the PinName vs. the expected InputPins before carrying on with the ExecuteInput
 
 	if (IsSupportedInputPinName(PinName))
 	{
+		const FFlowNodeClassStatScope NodeClassScope(*this);
 		ExecuteInput(PinName);
 	}
 
-	for (UFlowNodeAddOn* AddOn : AddOns)
-	{
-		AddOn->ExecuteInputForSelfAndAddOns(PinName);
-	}
+	// Same depth-first order as recursing through AddOns
+	(void) ForEachAddOnInline(
+		[&PinName](UFlowNodeAddOn& AddOn)
+		{
+			if (AddOn.IsSupportedInputPinName(PinName))
+			{
+				const FFlowNodeClassStatScope AddOnClassScope(AddOn);
+				AddOn.ExecuteInput(PinName);
+			}
+
+			return EFlowForEachAddOnFunctionReturnValue::Continue;
+		});
 }
 
 void UFlowNodeBase::ExecuteInput(const FName& PinName)
@@ -468,74 +482,14 @@ EFlowForEachAddOnFunctionReturnValue UFlowNodeBase::ForEachAddOnConst(
 	const FConstFlowNodeAddOnFunction& Function,
 	EFlowForEachAddOnChildRule AddOnChildRule) const
 {
-	FLOW_ASSERT_ENUM_MAX(EFlowForEachAddOnFunctionReturnValue, 3);
-
-	EFlowForEachAddOnFunctionReturnValue ReturnValue = EFlowForEachAddOnFunctionReturnValue::Continue;
-
-	for (const UFlowNodeAddOn* AddOn : AddOns)
-	{
-		if (!IsValid(AddOn))
-		{
-			continue;
-		}
-
-		ReturnValue = Function(*AddOn);
-
-		if (!ShouldContinueForEach(ReturnValue))
-		{
-			break;
-		}
-
-		FLOW_ASSERT_ENUM_MAX(EFlowForEachAddOnChildRule, 2);
-		if (AddOnChildRule == EFlowForEachAddOnChildRule::AllChildren)
-		{
-			ReturnValue = AddOn->ForEachAddOnConst(Function);
-
-			if (!ShouldContinueForEach(ReturnValue))
-			{
-				break;
-			}
-		}
-	}
-
-	return ReturnValue;
+	return ForEachAddOnConstInline(Function, AddOnChildRule);
 }
 
 EFlowForEachAddOnFunctionReturnValue UFlowNodeBase::ForEachAddOn(
 	const FFlowNodeAddOnFunction& Function,
 	EFlowForEachAddOnChildRule AddOnChildRule) const
 {
-	FLOW_ASSERT_ENUM_MAX(EFlowForEachAddOnFunctionReturnValue, 3);
-
-	EFlowForEachAddOnFunctionReturnValue ReturnValue = EFlowForEachAddOnFunctionReturnValue::Continue;
-
-	for (UFlowNodeAddOn* AddOn : AddOns)
-	{
-		if (!IsValid(AddOn))
-		{
-			continue;
-		}
-
-		ReturnValue = Function(*AddOn);
-
-		if (!ShouldContinueForEach(ReturnValue))
-		{
-			break;
-		}
-
-		FLOW_ASSERT_ENUM_MAX(EFlowForEachAddOnChildRule, 2);
-		if (AddOnChildRule == EFlowForEachAddOnChildRule::AllChildren)
-		{
-			ReturnValue = AddOn->ForEachAddOn(Function);
-
-			if (!ShouldContinueForEach(ReturnValue))
-			{
-				break;
-			}
-		}
-	}
-
-	return ReturnValue;
+	return ForEachAddOnInline(Function, AddOnChildRule);
 }
 
 EFlowForEachAddOnFunctionReturnValue UFlowNodeBase::ForEachAddOnForClassConst(
@@ -543,40 +497,13 @@ EFlowForEachAddOnFunctionReturnValue UFlowNodeBase::ForEachAddOnForClassConst(
 	const FConstFlowNodeAddOnFunction& Function,
 	EFlowForEachAddOnChildRule AddOnChildRule) const
 {
-	FLOW_ASSERT_ENUM_MAX(EFlowForEachAddOnFunctionReturnValue, 3);
-
-	EFlowForEachAddOnFunctionReturnValue ReturnValue = EFlowForEachAddOnFunctionReturnValue::Continue;
-
-	for (const UFlowNodeAddOn* AddOn : AddOns)
-	{
-		if (!IsValid(AddOn))
+	return ForEachAddOnForClassInline(
+		InterfaceOrClass,
+		[&Function](const UFlowNodeAddOn& AddOn)
 		{
-			continue;
-		}
-
-		if (AddOn->IsClassOrImplementsInterface(InterfaceOrClass))
-		{
-			ReturnValue = Function(*AddOn);
-
-			if (!ShouldContinueForEach(ReturnValue))
-			{
-				break;
-			}
-		}
-
-		FLOW_ASSERT_ENUM_MAX(EFlowForEachAddOnChildRule, 2);
-		if (AddOnChildRule == EFlowForEachAddOnChildRule::AllChildren)
-		{
-			ReturnValue = AddOn->ForEachAddOnForClassConst(InterfaceOrClass, Function);
-
-			if (!ShouldContinueForEach(ReturnValue))
-			{
-				break;
-			}
-		}
-	}
-
-	return ReturnValue;
+			return Function(AddOn);
+		},
+		AddOnChildRule);
 }
 
 EFlowForEachAddOnFunctionReturnValue UFlowNodeBase::ForEachAddOnForClass(
@@ -584,40 +511,22 @@ EFlowForEachAddOnFunctionReturnValue UFlowNodeBase::ForEachAddOnForClass(
 	const FFlowNodeAddOnFunction& Function,
 	EFlowForEachAddOnChildRule AddOnChildRule) const
 {
-	FLOW_ASSERT_ENUM_MAX(EFlowForEachAddOnFunctionReturnValue, 3);
+	return ForEachAddOnForClassInline(InterfaceOrClass, Function, AddOnChildRule);
+}
 
-	EFlowForEachAddOnFunctionReturnValue ReturnValue = EFlowForEachAddOnFunctionReturnValue::Continue;
+void UFlowNodeBase::BuildFlattenedAddOns()
+{
+	FlattenedAddOns.Reset();
 
 	for (UFlowNodeAddOn* AddOn : AddOns)
 	{
-		if (!IsValid(AddOn))
-		{
-			continue;
-		}
-
-		if (AddOn->IsClassOrImplementsInterface(InterfaceOrClass))
-		{
-			ReturnValue = Function(*AddOn);
-
-			if (!ShouldContinueForEach(ReturnValue))
-			{
-				break;
-			}
-		}
-
-		FLOW_ASSERT_ENUM_MAX(EFlowForEachAddOnChildRule, 2);
-		if (AddOnChildRule == EFlowForEachAddOnChildRule::AllChildren)
+		if (IsValid(AddOn))
 		{
-			ReturnValue = AddOn->ForEachAddOnForClass(InterfaceOrClass, Function);
-
-			if (!ShouldContinueForEach(ReturnValue))
-			{
-				break;
-			}
+			// AddOn instances are initialized before their parent finishes initialization, so their lists are already built
+			FlattenedAddOns.Add(AddOn);
+			FlattenedAddOns.Append(AddOn->FlattenedAddOns);
 		}
 	}
-
-	return ReturnValue;
 }
 
 #if WITH_EDITOR
@@ -1191,6 +1100,11 @@ FLOW_ASSERT_ENUM_MAX(EFlowPinType, 16);
 template <typename TFlowDataPinResultType, EFlowPinType PinType>
 bool TResolveDataPinWorkingData<TFlowDataPinResultType, PinType>::TrySetupWorkingData(const FName& PinName, const UFlowNodeBase& FlowNodeBase)
 {
+#if FLOW_TRACE_ENABLED
+	TracedNode = &FlowNodeBase;
+	TracedPinName = PinName;
+#endif
+
 	DataPinResult.Result = FlowNodeBase.TryResolveDataPinPrerequisites(PinName, FlowNode, FlowPin, PinType);
 	if (DataPinResult.Result != EFlowDataPinResolveResult::Success)
 	{
@@ -1210,6 +1124,8 @@ bool TResolveDataPinWorkingData<TFlowDataPinResultType, PinType>::TrySetupWorkin
 
 FFlowDataPinResult_Bool UFlowNodeBase::TryResolveDataPinAsBool(const FName& PinName) const
 {
+	FLOW_SCOPE_RESOLVE_DATA_PIN();
+
 	TResolveDataPinWorkingData<FFlowDataPinResult_Bool, EFlowPinType::Bool> WorkData;
 	if (!WorkData.TrySetupWorkingData(PinName, *this))
 	{
@@ -1231,6 +1147,8 @@ FFlowDataPinResult_Bool UFlowNodeBase::TryResolveDataPinAsBool(const FName& PinN
 
 FFlowDataPinResult_Int UFlowNodeBase::TryResolveDataPinAsInt(const FName& PinName) const
 {
+	FLOW_SCOPE_RESOLVE_DATA_PIN();
+
 	TResolveDataPinWorkingData<FFlowDataPinResult_Int, EFlowPinType::Int> WorkData;
 	if (!WorkData.TrySetupWorkingData(PinName, *this))
 	{
@@ -1252,6 +1170,8 @@ FFlowDataPinResult_Int UFlowNodeBase::TryResolveDataPinAsInt(const FName& PinNam
 
 FFlowDataPinResult_Float UFlowNodeBase::TryResolveDataPinAsFloat(const FName& PinName) const
 {
+	FLOW_SCOPE_RESOLVE_DATA_PIN();
+
 	TResolveDataPinWorkingData<FFlowDataPinResult_Float, EFlowPinType::Float> WorkData;
 	if (!WorkData.TrySetupWorkingData(PinName, *this))
 	{
@@ -1273,6 +1193,8 @@ FFlowDataPinResult_Float UFlowNodeBase::TryResolveDataPinAsFloat(const FName& Pi
 
 FFlowDataPinResult_Name UFlowNodeBase::TryResolveDataPinAsName(const FName& PinName) const
 {
+	FLOW_SCOPE_RESOLVE_DATA_PIN();
+
 	TResolveDataPinWorkingData<FFlowDataPinResult_Name, EFlowPinType::Name> WorkData;
 	if (!WorkData.TrySetupWorkingData(PinName, *this))
 	{
@@ -1294,6 +1216,8 @@ FFlowDataPinResult_Name UFlowNodeBase::TryResolveDataPinAsName(const FName& PinN
 
 FFlowDataPinResult_String UFlowNodeBase::TryResolveDataPinAsString(const FName& PinName) const
 {
+	FLOW_SCOPE_RESOLVE_DATA_PIN();
+
 	TResolveDataPinWorkingData<FFlowDataPinResult_String, EFlowPinType::String> WorkData;
 	if (!WorkData.TrySetupWorkingData(PinName, *this))
 	{
@@ -1315,6 +1239,8 @@ FFlowDataPinResult_String UFlowNodeBase::TryResolveDataPinAsString(const FName&
 
 FFlowDataPinResult_Text UFlowNodeBase::TryResolveDataPinAsText(const FName& PinName) const
 {
+	FLOW_SCOPE_RESOLVE_DATA_PIN();
+
 	TResolveDataPinWorkingData<FFlowDataPinResult_Text, EFlowPinType::Text> WorkData;
 	if (!WorkData.TrySetupWorkingData(PinName, *this))
 	{
@@ -1336,6 +1262,8 @@ FFlowDataPinResult_Text UFlowNodeBase::TryResolveDataPinAsText(const FName& PinN
 
 FFlowDataPinResult_Enum UFlowNodeBase::TryResolveDataPinAsEnum(const FName& PinName) const
 {
+	FLOW_SCOPE_RESOLVE_DATA_PIN();
+
 	TResolveDataPinWorkingData<FFlowDataPinResult_Enum, EFlowPinType::Enum> WorkData;
 	if (!WorkData.TrySetupWorkingData(PinName, *this))
 	{
@@ -1357,6 +1285,8 @@ FFlowDataPinResult_Enum UFlowNodeBase::TryResolveDataPinAsEnum(const FName& PinN
 
 FFlowDataPinResult_Vector UFlowNodeBase::TryResolveDataPinAsVector(const FName& PinName) const
 {
+	FLOW_SCOPE_RESOLVE_DATA_PIN();
+
 	TResolveDataPinWorkingData<FFlowDataPinResult_Vector, EFlowPinType::Vector> WorkData;
 	if (!WorkData.TrySetupWorkingData(PinName, *this))
 	{
@@ -1378,6 +1308,8 @@ FFlowDataPinResult_Vector UFlowNodeBase::TryResolveDataPinAsVector(const FName&
 
 FFlowDataPinResult_Rotator UFlowNodeBase::TryResolveDataPinAsRotator(const FName& PinName) const
 {
+	FLOW_SCOPE_RESOLVE_DATA_PIN();
+
 	TResolveDataPinWorkingData<FFlowDataPinResult_Rotator, EFlowPinType::Rotator> WorkData;
 	if (!WorkData.TrySetupWorkingData(PinName, *this))
 	{
@@ -1399,6 +1331,8 @@ FFlowDataPinResult_Rotator UFlowNodeBase::TryResolveDataPinAsRotator(const FName
 
 FFlowDataPinResult_Transform UFlowNodeBase::TryResolveDataPinAsTransform(const FName& PinName) const
 {
+	FLOW_SCOPE_RESOLVE_DATA_PIN();
+
 	TResolveDataPinWorkingData<FFlowDataPinResult_Transform, EFlowPinType::Transform> WorkData;
 	if (!WorkData.TrySetupWorkingData(PinName, *this))
 	{
@@ -1420,6 +1354,8 @@ FFlowDataPinResult_Transform UFlowNodeBase::TryResolveDataPinAsTransform(const F
 
 FFlowDataPinResult_GameplayTag UFlowNodeBase::TryResolveDataPinAsGameplayTag(const FName& PinName) const
 {
+	FLOW_SCOPE_RESOLVE_DATA_PIN();
+
 	TResolveDataPinWorkingData<FFlowDataPinResult_GameplayTag, EFlowPinType::GameplayTag> WorkData;
 	if (!WorkData.TrySetupWorkingData(PinName, *this))
 	{
@@ -1441,6 +1377,8 @@ FFlowDataPinResult_GameplayTag UFlowNodeBase::TryResolveDataPinAsGameplayTag(con
 
 FFlowDataPinResult_GameplayTagContainer UFlowNodeBase::TryResolveDataPinAsGameplayTagContainer(const FName& PinName) const
 {
+	FLOW_SCOPE_RESOLVE_DATA_PIN();
+
 	TResolveDataPinWorkingData<FFlowDataPinResult_GameplayTagContainer, EFlowPinType::GameplayTagContainer> WorkData;
 	if (!WorkData.TrySetupWorkingData(PinName, *this))
 	{
@@ -1462,6 +1400,8 @@ FFlowDataPinResult_GameplayTagContainer UFlowNodeBase::TryResolveDataPinAsGamepl
 
 FFlowDataPinResult_InstancedStruct UFlowNodeBase::TryResolveDataPinAsInstancedStruct(const FName& PinName) const
 {
+	FLOW_SCOPE_RESOLVE_DATA_PIN();
+
 	TResolveDataPinWorkingData<FFlowDataPinResult_InstancedStruct, EFlowPinType::InstancedStruct> WorkData;
 	if (!WorkData.TrySetupWorkingData(PinName, *this))
 	{
@@ -1483,6 +1423,8 @@ FFlowDataPinResult_InstancedStruct UFlowNodeBase::TryResolveDataPinAsInstancedSt
 
 FFlowDataPinResult_Object UFlowNodeBase::TryResolveDataPinAsObject(const FName& PinName) const
 {
+	FLOW_SCOPE_RESOLVE_DATA_PIN();
+
 	TResolveDataPinWorkingData<FFlowDataPinResult_Object, EFlowPinType::Object> WorkData;
 	if (!WorkData.TrySetupWorkingData(PinName, *this))
 	{
@@ -1504,6 +1446,8 @@ FFlowDataPinResult_Object UFlowNodeBase::TryResolveDataPinAsObject(const FName&
 
 FFlowDataPinResult_Class UFlowNodeBase::TryResolveDataPinAsClass(const FName& PinName) const
 {
+	FLOW_SCOPE_RESOLVE_DATA_PIN();
+
 	TResolveDataPinWorkingData<FFlowDataPinResult_Class, EFlowPinType::Class> WorkData;
 	if (!WorkData.TrySetupWorkingData(PinName, *this))
 	{
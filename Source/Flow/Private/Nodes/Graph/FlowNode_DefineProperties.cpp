@@ -120,26 +120,42 @@ void UFlowNode_DefineProperties::PostEditChangeChainProperty(FPropertyChangedCha
 #endif // WITH_EDITOR
 
 bool UFlowNode_DefineProperties::TryFormatTextWithNamedPropertiesAsParameters(const FText& FormatText, FText& OutFormattedText) const
+{
+	return TryFormatTextWithNamedPropertiesAsParameters(FTextFormat(FormatText), OutFormattedText);
+}
+
+bool UFlowNode_DefineProperties::TryFormatTextWithNamedPropertiesAsParameters(const FTextFormat& CompiledFormat, FText& OutFormattedText) const
+{
+	FFormatNamedArguments Arguments;
+	if (!TryBuildFormatNamedArguments(Arguments))
+	{
+		return false;
+	}
+
+	OutFormattedText = FText::Format(CompiledFormat, MoveTemp(Arguments));
+
+	return true;
+}
+
+bool UFlowNode_DefineProperties::TryBuildFormatNamedArguments(FFormatNamedArguments& OutArguments) const
 {
 	if (NamedProperties.IsEmpty())
 	{
 		return false;
 	}
 
-	FFormatNamedArguments Arguments;
+	OutArguments.Reserve(NamedProperties.Num());
 	for (const FFlowNamedDataPinProperty& NamedProperty : NamedProperties)
 	{
 		if (!NamedProperty.Name.IsValid())
 		{
 			LogWarning(TEXT("Could not format text with a nameless named property"));
 		}
-		else if (!TryAddValueToFormatNamedArguments(NamedProperty, Arguments))
+		else if (!TryAddValueToFormatNamedArguments(NamedProperty, OutArguments))
 		{
 			LogWarning(FString::Printf(TEXT("Could not format text for named property %s"), *NamedProperty.Name.ToString()));
 		}
 	}
 
-	OutFormattedText = FText::Format(FormatText, Arguments);
-
 	return true;
 }
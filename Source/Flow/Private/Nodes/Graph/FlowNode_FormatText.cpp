@@ -2,6 +2,8 @@
 
 #include "Nodes/Graph/FlowNode_FormatText.h"
 
+#include "Internationalization/TextLocalizationManager.h"
+
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowNode_FormatText)
 
 #define LOCTEXT_NAMESPACE "FlowNode_FormatText"
@@ -21,13 +23,17 @@ UFlowNode_FormatText::UFlowNode_FormatText(const FObjectInitializer& ObjectIniti
 
 FFlowDataPinResult_Name UFlowNode_FormatText::TrySupplyDataPinAsName_Implementation(const FName& PinName) const
 {
-	FText FormattedText;
-	const EFlowDataPinResolveResult FormatResult = TryResolveFormatText(PinName, FormattedText);
+	const EFlowDataPinResolveResult FormatResult = TryUpdateFormatCache(PinName);
 	if (FormatResult != EFlowDataPinResolveResult::Invalid)
 	{
 		if (FormatResult == EFlowDataPinResolveResult::Success)
 		{
-			return FFlowDataPinResult_Name(FName(FormattedText.ToString()));
+			if (!FormatCache.FormattedName.IsSet())
+			{
+				FormatCache.FormattedName = FName(FormatCache.FormattedText.ToString());
+			}
+
+			return FFlowDataPinResult_Name(FormatCache.FormattedName.GetValue());
 		}
 		else
 		{
@@ -40,13 +46,17 @@ FFlowDataPinResult_Name UFlowNode_FormatText::TrySupplyDataPinAsName_Implementat
 
 FFlowDataPinResult_String UFlowNode_FormatText::TrySupplyDataPinAsString_Implementation(const FName& PinName) const
 {
-	FText FormattedText;
-	const EFlowDataPinResolveResult FormatResult = TryResolveFormatText(PinName, FormattedText);
+	const EFlowDataPinResolveResult FormatResult = TryUpdateFormatCache(PinName);
 	if (FormatResult != EFlowDataPinResolveResult::Invalid)
 	{
 		if (FormatResult == EFlowDataPinResolveResult::Success)
 		{
-			return FFlowDataPinResult_String(FormattedText.ToString());
+			if (!FormatCache.FormattedString.IsSet())
+			{
+				FormatCache.FormattedString = FormatCache.FormattedText.ToString();
+			}
+
+			return FFlowDataPinResult_String(FormatCache.FormattedString.GetValue());
 		}
 		else
 		{
@@ -59,13 +69,12 @@ FFlowDataPinResult_String UFlowNode_FormatText::TrySupplyDataPinAsString_Impleme
 
 FFlowDataPinResult_Text UFlowNode_FormatText::TrySupplyDataPinAsText_Implementation(const FName& PinName) const
 {
-	FText FormattedText;
-	const EFlowDataPinResolveResult FormatResult = TryResolveFormatText(PinName, FormattedText);
+	const EFlowDataPinResolveResult FormatResult = TryUpdateFormatCache(PinName);
 	if (FormatResult != EFlowDataPinResolveResult::Invalid)
 	{
 		if (FormatResult == EFlowDataPinResolveResult::Success)
 		{
-			return FFlowDataPinResult_Text(FormattedText);
+			return FFlowDataPinResult_Text(FormatCache.FormattedText);
 		}
 		else
 		{
@@ -78,19 +87,68 @@ FFlowDataPinResult_Text UFlowNode_FormatText::TrySupplyDataPinAsText_Implementat
 
 EFlowDataPinResolveResult UFlowNode_FormatText::TryResolveFormatText(const FName& PinName, FText& OutFormattedText) const
 {
-	if (PinName == OUTPIN_TextOutput)
+	const EFlowDataPinResolveResult FormatResult = TryUpdateFormatCache(PinName);
+	if (FormatResult == EFlowDataPinResolveResult::Success)
 	{
-		if (TryFormatTextWithNamedPropertiesAsParameters(FormatText, OutFormattedText))
-		{
-			return EFlowDataPinResolveResult::Success;
-		}
-		else
+		OutFormattedText = FormatCache.FormattedText;
+	}
+
+	return FormatResult;
+}
+
+EFlowDataPinResolveResult UFlowNode_FormatText::TryUpdateFormatCache(const FName& PinName) const
+{
+	if (PinName != OUTPIN_TextOutput)
+	{
+		return EFlowDataPinResolveResult::Invalid;
+	}
+
+	// recompile the pattern if it was edited or the culture changed
+	const uint16 TextRevision = FTextLocalizationManager::Get().GetTextRevision();
+	if (!FormatCache.CompiledFormat.IsValid() || TextRevision != FormatCache.TextRevision || !FormatCache.CompiledFormat.GetSourceText().IdenticalTo(FormatText))
+	{
+		FormatCache = FFormatTextCache();
+		FormatCache.CompiledFormat = FTextFormat(FormatText);
+		FormatCache.TextRevision = TextRevision;
+	}
+
+	// input values have to be resolved every time, as any of the connected pins might supply a different value now
+	FFormatNamedArguments Arguments;
+	if (!TryBuildFormatNamedArguments(Arguments))
+	{
+		FormatCache.bValid = false;
+		return EFlowDataPinResolveResult::FailedWithError;
+	}
+
+	if (!FormatCache.bValid || !AreArgumentsIdentical(Arguments, FormatCache.Arguments))
+	{
+		FormatCache.FormattedText = FText::Format(FormatCache.CompiledFormat, Arguments);
+		FormatCache.FormattedString.Reset();
+		FormatCache.FormattedName.Reset();
+		FormatCache.Arguments = MoveTemp(Arguments);
+		FormatCache.bValid = true;
+	}
+
+	return EFlowDataPinResolveResult::Success;
+}
+
+bool UFlowNode_FormatText::AreArgumentsIdentical(const FFormatNamedArguments& A, const FFormatNamedArguments& B)
+{
+	if (A.Num() != B.Num())
+	{
+		return false;
+	}
+
+	for (const TPair<FString, FFormatArgumentValue>& Argument : A)
+	{
+		const FFormatArgumentValue* OtherValue = B.Find(Argument.Key);
+		if (OtherValue == nullptr || !Argument.Value.IdenticalTo(*OtherValue, ETextIdenticalModeFlags::DeepCompare | ETextIdenticalModeFlags::LexicalCompareInvariants))
 		{
-			return EFlowDataPinResolveResult::FailedWithError;
+			return false;
 		}
 	}
 
-	return EFlowDataPinResolveResult::Invalid;
+	return true;
 }
 
 #if WITH_EDITOR
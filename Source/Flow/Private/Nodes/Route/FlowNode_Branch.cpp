@@ -26,6 +26,21 @@ UFlowNode_Branch::UFlowNode_Branch(const FObjectInitializer& ObjectInitializer)
 	AllowedSignalModes = {EFlowSignalMode::Enabled, EFlowSignalMode::Disabled};
 }
 
+void UFlowNode_Branch::InitializeInstance()
+{
+	Super::InitializeInstance();
+
+	// AddOns are instanced by now
+	PredicateProgram.CompileAND(AddOns);
+}
+
+void UFlowNode_Branch::DeinitializeInstance()
+{
+	PredicateProgram.Reset();
+
+	Super::DeinitializeInstance();
+}
+
 EFlowAddOnAcceptResult UFlowNode_Branch::AcceptFlowNodeAddOnChild_Implementation(const UFlowNodeAddOn* AddOnTemplate, const TArray<UFlowNodeAddOn*>& AdditionalAddOnsToAssumeAreChildren) const
 {
 	if (IFlowPredicateInterface::ImplementsInterfaceSafe(AddOnTemplate))
@@ -38,6 +53,6 @@ EFlowAddOnAcceptResult UFlowNode_Branch::AcceptFlowNodeAddOnChild_Implementation
 
 void UFlowNode_Branch::ExecuteInput(const FName& PinName)
 {
-	const bool bResult = UFlowNodeAddOn_PredicateAND::EvaluatePredicateAND(AddOns);
+	const bool bResult = PredicateProgram.IsCompiled() ? PredicateProgram.Evaluate() : UFlowNodeAddOn_PredicateAND::EvaluatePredicateAND(AddOns);
 	TriggerOutput(bResult ? OUTPIN_True : OUTPIN_False, true);
 }
@@ -26,43 +26,19 @@ void UFlowNode_ExecutionMultiGate::ExecuteInput(const FName& PinName)
 {
 	if (PinName == DefaultInputPin.PinName)
 	{
-		if (Completed.Num() == 0)
-		{
-			Completed.Init(false, OutputPins.Num());
-		}
-
-		if (!Completed.Contains(false))
+		const int32 OutputNum = FMath::Min(OutputPins.Num(), FFlowPinBitmask::MaxPins);
+		if (OutputNum == 0 || CompletedOutputs.AreAllSet(OutputNum))
 		{
 			return;
 		}
 
-		const bool bUseStartIndex = !Completed.Contains(true) && Completed.IsValidIndex(StartIndex);
+		const bool bUseStartIndex = CompletedOutputs.IsEmpty() && StartIndex >= 0 && StartIndex < OutputNum;
 
 		if (bRandom)
 		{
-			int32 Index;
-			if (bUseStartIndex)
-			{
-				Index = StartIndex;
-			}
-			else
-			{
-				TArray<int32> AvailableIndexes;
-				AvailableIndexes.Reserve(Completed.Num()); // todo
-
-				for (int32 i = 0; i < Completed.Num(); i++)
-				{
-					if (Completed[i] == false)
-					{
-						AvailableIndexes.Emplace(i);
-					}
-				}
-
-				const int32 Random = FMath::RandRange(0, AvailableIndexes.Num() - 1);
-				Index = AvailableIndexes[Random];
-			}
+			const int32 Index = bUseStartIndex ? StartIndex : CompletedOutputs.GetRandomUnsetIndex(OutputNum);
 
-			Completed[Index] = true;
+			CompletedOutputs.Set(Index);
 			TriggerOutput(OutputPins[Index].PinName, false);
 		}
 		else
@@ -75,13 +51,13 @@ void UFlowNode_ExecutionMultiGate::ExecuteInput(const FName& PinName)
 			const int32 CurrentOutput = NextOutput;
 			// We have to calculate NextOutput before TriggerOutput(..)
 			// TriggerOutput may call Reset and Cleanup
-			NextOutput = ++NextOutput % OutputPins.Num();
+			NextOutput = (NextOutput + 1) % OutputNum;
 
-			Completed[CurrentOutput] = true;
+			CompletedOutputs.Set(CurrentOutput);
 			TriggerOutput(OutputPins[CurrentOutput].PinName, false);
 		}
 
-		if (!Completed.Contains(false) && bLoop)
+		if (CompletedOutputs.AreAllSet(OutputNum) && bLoop)
 		{
 			Finish();
 		}
@@ -95,11 +71,24 @@ void UFlowNode_ExecutionMultiGate::ExecuteInput(const FName& PinName)
 void UFlowNode_ExecutionMultiGate::Cleanup()
 {
 	NextOutput = 0;
-	Completed.Reset();
+	CompletedOutputs.Reset();
 	
 	Super::Cleanup();
 }
 
+void UFlowNode_ExecutionMultiGate::OnLoad_Implementation()
+{
+	for (int32 Index = 0; Index < Completed.Num(); Index++)
+	{
+		if (Completed[Index] && FFlowPinBitmask::IsValidIndex(Index))
+		{
+			CompletedOutputs.Set(Index);
+		}
+	}
+
+	Completed.Empty();
+}
+
 #if WITH_EDITOR
 FString UFlowNode_ExecutionMultiGate::GetNodeDescription() const
 {
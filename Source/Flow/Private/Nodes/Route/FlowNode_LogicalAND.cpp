@@ -17,9 +17,16 @@ UFlowNode_LogicalAND::UFlowNode_LogicalAND(const FObjectInitializer& ObjectIniti
 
 void UFlowNode_LogicalAND::ExecuteInput(const FName& PinName)
 {
-	ExecutedInputNames.Add(PinName);
+	const int32 PinIndex = InputPins.IndexOfByKey(PinName);
+	if (!FFlowPinBitmask::IsValidIndex(PinIndex))
+	{
+		LogError(FString::Printf(TEXT("Input Pin %s can't be tracked, AND supports up to %d inputs"), *PinName.ToString(), FFlowPinBitmask::MaxPins));
+		return;
+	}
+
+	ExecutedInputs.Set(PinIndex);
 
-	if (ExecutedInputNames.Num() == InputPins.Num())
+	if (ExecutedInputs.AreAllSet(InputPins.Num()))
 	{
 		TriggerFirstOutput(true);
 	}
@@ -27,5 +34,19 @@ void UFlowNode_LogicalAND::ExecuteInput(const FName& PinName)
 
 void UFlowNode_LogicalAND::Cleanup()
 {
+	ExecutedInputs.Reset();
+}
+
+void UFlowNode_LogicalAND::OnLoad_Implementation()
+{
+	for (const FName& InputName : ExecutedInputNames)
+	{
+		const int32 PinIndex = InputPins.IndexOfByKey(InputName);
+		if (FFlowPinBitmask::IsValidIndex(PinIndex))
+		{
+			ExecutedInputs.Set(PinIndex);
+		}
+	}
+
 	ExecutedInputNames.Empty();
 }
@@ -4,6 +4,9 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(FlowNode_LogicalOR)
 
+const FName UFlowNode_LogicalOR::INPIN_Enable(TEXT("Enable"));
+const FName UFlowNode_LogicalOR::INPIN_Disable(TEXT("Disable"));
+
 UFlowNode_LogicalOR::UFlowNode_LogicalOR(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, bEnabled(true)
@@ -16,13 +19,13 @@ UFlowNode_LogicalOR::UFlowNode_LogicalOR(const FObjectInitializer& ObjectInitial
 #endif
 
 	SetNumberedInputPins(0, 1);
-	InputPins.Add(FFlowPin(TEXT("Enable"), TEXT("Enabling resets Execution Count")));
-	InputPins.Add(FFlowPin(TEXT("Disable"), TEXT("Disabling resets Execution Count")));
+	InputPins.Add(FFlowPin(INPIN_Enable, TEXT("Enabling resets Execution Count")));
+	InputPins.Add(FFlowPin(INPIN_Disable, TEXT("Disabling resets Execution Count")));
 }
 
 void UFlowNode_LogicalOR::ExecuteInput(const FName& PinName)
 {
-	if (PinName == TEXT("Enable"))
+	if (PinName == INPIN_Enable)
 	{
 		if (!bEnabled)
 		{
@@ -32,7 +35,7 @@ void UFlowNode_LogicalOR::ExecuteInput(const FName& PinName)
 		return;
 	}
 
-	if (PinName == TEXT("Disable"))
+	if (PinName == INPIN_Disable)
 	{
 		if (bEnabled)
 		{
@@ -42,7 +45,8 @@ void UFlowNode_LogicalOR::ExecuteInput(const FName& PinName)
 		return;
 	}
 
-	if (bEnabled && PinName.ToString().IsNumeric())
+	// every other input is one of the numbered pins, TriggerInput already rejected unknown names
+	if (bEnabled)
 	{
 		ExecutionCount++;
 		if (ExecutionLimit > 0 && ExecutionCount == ExecutionLimit)
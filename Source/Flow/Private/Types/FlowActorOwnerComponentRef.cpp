@@ -4,6 +4,7 @@
 #include "Components/ActorComponent.h"
 #include "GameFramework/Actor.h"
 #include "Misc/RuntimeErrors.h"
+#include "Misc/StringBuilder.h"
 #include "FlowLogChannels.h"
 
 UActorComponent* FFlowActorOwnerComponentRef::TryResolveComponent(const AActor& InActor, bool bWarnIfFailed)
@@ -32,17 +33,28 @@ UActorComponent* FFlowActorOwnerComponentRef::TryResolveComponentByName(const AA
 {
 	constexpr bool bIncludeFromChildActors = false;
 
+	if (InComponentName.IsNone())
+	{
+		return nullptr;
+	}
+
+	// Blueprint-added components may carry the "_C" suffix, look up the suffixed name once instead of cleaning up every component name
+	// FNAME_Find doesn't add a new entry, NAME_None means no component can have this name
+	TStringBuilder<FName::StringBufferSize> SuffixedNameBuilder;
+	InComponentName.AppendString(SuffixedNameBuilder);
+	SuffixedNameBuilder.Append(TEXT("_C"));
+	const FName SuffixedComponentName(SuffixedNameBuilder.ToView(), FNAME_Find);
+
 	UActorComponent* FoundComponent = nullptr;
 
 	// Search for the component (by name) on the given actor
 	InActor.ForEachComponent(
 		bIncludeFromChildActors,
-		[&FoundComponent, &InComponentName](UActorComponent* Component)
+		[&FoundComponent, &InComponentName, &SuffixedComponentName](UActorComponent* Component)
 		{
-			FString CleanedName = Component->GetName();
-			CleanedName.RemoveFromEnd(TEXT("_C"));
+			const FName ComponentName = Component->GetFName();
 
-			if ((InComponentName == Component->GetFName() || InComponentName == FName(CleanedName)) &&
+			if ((ComponentName == InComponentName || (!SuffixedComponentName.IsNone() && ComponentName == SuffixedComponentName)) &&
 				ensureAsRuntimeWarning(FoundComponent == nullptr))
 			{
 				FoundComponent = Component;
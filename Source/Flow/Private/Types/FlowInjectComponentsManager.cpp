@@ -2,7 +2,9 @@
 
 #include "Types/FlowInjectComponentsManager.h"
 #include "Types/FlowInjectComponentsHelper.h"
+#include "Types/FlowInjectComponentsPool.h"
 #include "Components/ActorComponent.h"
+#include "Engine/World.h"
 #include "GameFramework/Actor.h"
 #include "FlowLogChannels.h"
 
@@ -77,6 +79,15 @@ void UFlowInjectComponentsManager::RemoveAndUnregisterComponent(AActor& Actor, U
 
 	UnregisterOnDestroyedDelegate(Actor);
 
+	if (bReturnComponentsToPool)
+	{
+		UFlowInjectComponentsPool* Pool = UWorld::GetSubsystem<UFlowInjectComponentsPool>(Actor.GetWorld());
+		if (Pool && Pool->ReleaseComponent(Actor, ComponentInstance))
+		{
+			return;
+		}
+	}
+
 	FFlowInjectComponentsHelper::DestroyInjectedComponent(Actor, ComponentInstance);
 }
 
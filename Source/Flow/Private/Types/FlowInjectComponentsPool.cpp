@@ -0,0 +1,177 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "Types/FlowInjectComponentsPool.h"
+#include "Components/ActorComponent.h"
+#include "Components/SceneComponent.h"
+#include "GameFramework/Actor.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FlowInjectComponentsPool)
+
+namespace FlowInjectComponentsPool
+{
+	// Components created from a class have the class default object as the archetype
+	const UActorComponent* GetComponentTemplate(const UActorComponent& ComponentInstance)
+	{
+		const UActorComponent* Archetype = Cast<UActorComponent>(ComponentInstance.GetArchetype());
+		return (Archetype && !Archetype->HasAnyFlags(RF_ClassDefaultObject)) ? Archetype : nullptr;
+	}
+}
+
+bool UFlowInjectComponentsPool::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UFlowInjectComponentsPool::Deinitialize()
+{
+	// dropping references lets the next garbage collection destroy pooled components, as nothing else owns them
+	for (const TPair<TObjectKey<AActor>, TArray<FFlowPooledComponent>>& Pair : PooledComponents)
+	{
+		if (AActor* Actor = Pair.Key.ResolveObjectPtr())
+		{
+			Actor->OnEndPlay.RemoveDynamic(this, &UFlowInjectComponentsPool::OnActorEndPlay);
+		}
+	}
+
+	PooledComponents.Empty();
+	PooledComponentKeys.Empty();
+
+	Super::Deinitialize();
+}
+
+void UFlowInjectComponentsPool::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	UFlowInjectComponentsPool* This = CastChecked<UFlowInjectComponentsPool>(InThis);
+	for (TPair<TObjectKey<AActor>, TArray<FFlowPooledComponent>>& Pair : This->PooledComponents)
+	{
+		for (FFlowPooledComponent& PooledComponent : Pair.Value)
+		{
+			Collector.AddReferencedObject(PooledComponent.Component, This);
+		}
+	}
+
+	Super::AddReferencedObjects(InThis, Collector);
+}
+
+UActorComponent* UFlowInjectComponentsPool::TryAcquireComponent(AActor& Actor, const UClass& ComponentClass, const UActorComponent* ComponentTemplate)
+{
+	TArray<FFlowPooledComponent>* ActorComponents = PooledComponents.Find(&Actor);
+	if (ActorComponents == nullptr)
+	{
+		return nullptr;
+	}
+
+	const TObjectKey<UActorComponent> TemplateKey(ComponentTemplate);
+	for (int32 Index = ActorComponents->Num() - 1; Index >= 0; --Index)
+	{
+		const FFlowPooledComponent& PooledComponent = (*ActorComponents)[Index];
+		UActorComponent* Component = PooledComponent.Component;
+
+		if (!IsValid(Component))
+		{
+			PooledComponentKeys.Remove(PooledComponent.ComponentKey);
+			ActorComponents->RemoveAtSwap(Index);
+			continue;
+		}
+
+		if (Component->GetClass() == &ComponentClass && PooledComponent.ComponentTemplate == TemplateKey)
+		{
+			PooledComponentKeys.Remove(PooledComponent.ComponentKey);
+			ActorComponents->RemoveAtSwap(Index);
+
+			if (ActorComponents->Num() == 0)
+			{
+				RemoveActorEntry(Actor);
+			}
+
+			Actor.AddOwnedComponent(Component);
+			return Component;
+		}
+	}
+
+	if (ActorComponents->Num() == 0)
+	{
+		RemoveActorEntry(Actor);
+	}
+
+	return nullptr;
+}
+
+bool UFlowInjectComponentsPool::ReleaseComponent(AActor& Actor, UActorComponent& ComponentInstance)
+{
+	if (!CanPoolComponent(ComponentInstance) || Actor.IsActorBeingDestroyed())
+	{
+		return false;
+	}
+
+	// Mirrors UActorComponent::DestroyComponent, so the component goes through the same lifecycle after being registered again
+	if (ComponentInstance.HasBegunPlay())
+	{
+		ComponentInstance.EndPlay(EEndPlayReason::RemovedFromWorld);
+	}
+
+	if (ComponentInstance.HasBeenInitialized())
+	{
+		ComponentInstance.UninitializeComponent();
+	}
+
+	ComponentInstance.Deactivate();
+
+	// SetupAttachment can't be used again on a component that is still attached
+	if (USceneComponent* SceneComponentInstance = Cast<USceneComponent>(&ComponentInstance))
+	{
+		SceneComponentInstance->DetachFromComponent(FDetachmentTransformRules::KeepRelativeTransform);
+	}
+
+	if (ComponentInstance.IsRegistered())
+	{
+		ComponentInstance.UnregisterComponent();
+	}
+
+	// pooled component must not be returned by FindComponentByClass, GetComponents and similar lookups
+	Actor.RemoveOwnedComponent(&ComponentInstance);
+
+	TArray<FFlowPooledComponent>* ActorComponents = PooledComponents.Find(&Actor);
+	if (ActorComponents == nullptr)
+	{
+		ActorComponents = &PooledComponents.Add(&Actor);
+		Actor.OnEndPlay.AddUniqueDynamic(this, &UFlowInjectComponentsPool::OnActorEndPlay);
+	}
+
+	ActorComponents->Add({&ComponentInstance, &ComponentInstance, FlowInjectComponentsPool::GetComponentTemplate(ComponentInstance)});
+	PooledComponentKeys.Add(&ComponentInstance);
+	return true;
+}
+
+int32 UFlowInjectComponentsPool::GetNumPooledComponents() const
+{
+	int32 Result = 0;
+	for (const TPair<TObjectKey<AActor>, TArray<FFlowPooledComponent>>& Pair : PooledComponents)
+	{
+		Result += Pair.Value.Num();
+	}
+	return Result;
+}
+
+bool UFlowInjectComponentsPool::CanPoolComponent(const UActorComponent& ComponentInstance)
+{
+	return !ComponentInstance.GetIsReplicated();
+}
+
+void UFlowInjectComponentsPool::OnActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason)
+{
+	TArray<FFlowPooledComponent> ActorComponents;
+	if (PooledComponents.RemoveAndCopyValue(Actor, ActorComponents))
+	{
+		for (const FFlowPooledComponent& PooledComponent : ActorComponents)
+		{
+			PooledComponentKeys.Remove(PooledComponent.ComponentKey);
+		}
+	}
+}
+
+void UFlowInjectComponentsPool::RemoveActorEntry(AActor& Actor)
+{
+	PooledComponents.Remove(&Actor);
+	Actor.OnEndPlay.RemoveDynamic(this, &UFlowInjectComponentsPool::OnActorEndPlay);
+}
@@ -0,0 +1,50 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "Types/FlowMemoryFootprint.h"
+
+#include "Serialization/ArchiveCountMem.h"
+#include "UObject/Object.h"
+
+#if !UE_BUILD_SHIPPING
+SIZE_T FFlowMemoryFootprint::GetTotal() const
+{
+	return AssetObject + NodeObjects + AddOns + Pins + Connections + PinRecords + DataPinPayloads + SaveBuffers;
+}
+
+FString FFlowMemoryFootprint::ToString() const
+{
+	return FString::Printf(TEXT("Total %s | Asset %s, Nodes %s, AddOns %s, Pins %s, Connections %s, Pin Records %s, Data Pins %s, Save Buffers %s"),
+		*FormatBytes(GetTotal()), *FormatBytes(AssetObject), *FormatBytes(NodeObjects), *FormatBytes(AddOns), *FormatBytes(Pins),
+		*FormatBytes(Connections), *FormatBytes(PinRecords), *FormatBytes(DataPinPayloads), *FormatBytes(SaveBuffers));
+}
+
+FFlowMemoryFootprint& FFlowMemoryFootprint::operator+=(const FFlowMemoryFootprint& Other)
+{
+	AssetObject += Other.AssetObject;
+	NodeObjects += Other.NodeObjects;
+	AddOns += Other.AddOns;
+	Pins += Other.Pins;
+	Connections += Other.Connections;
+	PinRecords += Other.PinRecords;
+	DataPinPayloads += Other.DataPinPayloads;
+	SaveBuffers += Other.SaveBuffers;
+	return *this;
+}
+
+SIZE_T FFlowMemoryFootprint::GetObjectBytes(const UObject* Object)
+{
+	if (Object == nullptr)
+	{
+		return 0;
+	}
+
+	// archive serializes properties of this object only, it doesn't follow object references
+	const FArchiveCountMem CountMem(Object);
+	return CountMem.GetMax() + const_cast<UObject*>(Object)->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+}
+
+FString FFlowMemoryFootprint::FormatBytes(const SIZE_T Bytes)
+{
+	return FString::Printf(TEXT("%.1f KB"), static_cast<double>(Bytes) / 1024.0);
+}
+#endif
@@ -0,0 +1,201 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "Types/FlowPredicateProgram.h"
+#include "AddOns/FlowNodeAddOn_PredicateAND.h"
+#include "AddOns/FlowNodeAddOn_PredicateNOT.h"
+#include "AddOns/FlowNodeAddOn_PredicateOR.h"
+#include "Interfaces/FlowPredicateInterface.h"
+
+void FFlowPredicateProgram::CompileAND(const TArray<UFlowNodeAddOn*>& AddOns)
+{
+	Ops.Reset();
+	EmitAND(AddOns);
+	Ops.Shrink();
+}
+
+void FFlowPredicateProgram::CompileOR(const TArray<UFlowNodeAddOn*>& AddOns)
+{
+	Ops.Reset();
+	EmitOR(AddOns);
+	Ops.Shrink();
+}
+
+void FFlowPredicateProgram::CompileNOT(const UFlowNodeAddOn_PredicateNOT& PredicateNOT)
+{
+	Ops.Reset();
+	EmitNOT(PredicateNOT);
+	Ops.Shrink();
+}
+
+bool FFlowPredicateProgram::Evaluate() const
+{
+	bool bResult = true;
+
+	int32 OpIndex = 0;
+	while (Ops.IsValidIndex(OpIndex))
+	{
+		const FFlowPredicateOp& Op = Ops[OpIndex];
+
+		switch (Op.OpCode)
+		{
+		case EFlowPredicateOpCode::SetTrue:
+			bResult = true;
+			break;
+		case EFlowPredicateOpCode::EvaluateNative:
+			bResult = Op.NativePredicate->EvaluatePredicate_Implementation();
+			break;
+		case EFlowPredicateOpCode::EvaluateBlueprint:
+			bResult = IFlowPredicateInterface::Execute_EvaluatePredicate(Op.AddOn);
+			break;
+		case EFlowPredicateOpCode::Not:
+			bResult = !bResult;
+			break;
+		case EFlowPredicateOpCode::JumpIfFalse:
+			if (!bResult)
+			{
+				OpIndex = Op.JumpTarget;
+				continue;
+			}
+			break;
+		case EFlowPredicateOpCode::JumpIfTrue:
+			if (bResult)
+			{
+				OpIndex = Op.JumpTarget;
+				continue;
+			}
+			break;
+		default:
+			checkNoEntry();
+			break;
+		}
+
+		++OpIndex;
+	}
+
+	return bResult;
+}
+
+bool FFlowPredicateProgram::ShouldCompileForComposite(const UFlowNodeAddOn& Composite)
+{
+	const UObject* Outer = Composite.GetOuter();
+	return !(Outer->IsA<UFlowNodeAddOn_PredicateAND>() || Outer->IsA<UFlowNodeAddOn_PredicateOR>() || Outer->IsA<UFlowNodeAddOn_PredicateNOT>());
+}
+
+void FFlowPredicateProgram::EmitAddOn(const UFlowNodeAddOn& AddOn)
+{
+	// Composites are NotBlueprintable, so these can be safely inlined
+	if (const UFlowNodeAddOn_PredicateAND* PredicateAND = Cast<UFlowNodeAddOn_PredicateAND>(&AddOn))
+	{
+		EmitAND(PredicateAND->GetFlowNodeAddOnChildren());
+		return;
+	}
+
+	if (const UFlowNodeAddOn_PredicateOR* PredicateOR = Cast<UFlowNodeAddOn_PredicateOR>(&AddOn))
+	{
+		EmitOR(PredicateOR->GetFlowNodeAddOnChildren());
+		return;
+	}
+
+	if (const UFlowNodeAddOn_PredicateNOT* PredicateNOT = Cast<UFlowNodeAddOn_PredicateNOT>(&AddOn))
+	{
+		EmitNOT(*PredicateNOT);
+		return;
+	}
+
+	FFlowPredicateOp& Op = Ops.AddDefaulted_GetRef();
+	Op.AddOn = &AddOn;
+
+	// Blueprint implementation (or override) is a script function, otherwise the native thunk would just call the _Implementation
+	const UFunction* EvaluateFunction = AddOn.FindFunction(GET_FUNCTION_NAME_CHECKED(IFlowPredicateInterface, EvaluatePredicate));
+	const IFlowPredicateInterface* NativePredicate = Cast<IFlowPredicateInterface>(&AddOn);
+
+	if (NativePredicate && (EvaluateFunction == nullptr || EvaluateFunction->HasAnyFunctionFlags(FUNC_Native)))
+	{
+		Op.OpCode = EFlowPredicateOpCode::EvaluateNative;
+		Op.NativePredicate = NativePredicate;
+	}
+	else
+	{
+		Op.OpCode = EFlowPredicateOpCode::EvaluateBlueprint;
+	}
+}
+
+void FFlowPredicateProgram::EmitAND(const TArray<UFlowNodeAddOn*>& AddOns)
+{
+	// The "no AddOns (that qualify)" case results in a "true" result
+	Ops.Add({EFlowPredicateOpCode::SetTrue});
+
+	TArray<int32, TInlineAllocator<8>> JumpOpIndices;
+	for (const UFlowNodeAddOn* AddOn : AddOns)
+	{
+		if (IFlowPredicateInterface::ImplementsInterfaceSafe(AddOn))
+		{
+			EmitAddOn(*AddOn);
+			JumpOpIndices.Add(EmitJump(EFlowPredicateOpCode::JumpIfFalse));
+		}
+	}
+
+	PatchJumpsToEnd(JumpOpIndices);
+}
+
+void FFlowPredicateProgram::EmitOR(const TArray<UFlowNodeAddOn*>& AddOns)
+{
+	// For parity with PredicateAND, the "no AddOns (that qualify)" case results in a "true" result
+	// Otherwise the result of the last evaluated predicate is false, if no jump happened
+	Ops.Add({EFlowPredicateOpCode::SetTrue});
+
+	TArray<int32, TInlineAllocator<8>> JumpOpIndices;
+	for (const UFlowNodeAddOn* AddOn : AddOns)
+	{
+		if (IFlowPredicateInterface::ImplementsInterfaceSafe(AddOn))
+		{
+			EmitAddOn(*AddOn);
+			JumpOpIndices.Add(EmitJump(EFlowPredicateOpCode::JumpIfTrue));
+		}
+	}
+
+	PatchJumpsToEnd(JumpOpIndices);
+}
+
+void FFlowPredicateProgram::EmitNOT(const UFlowNodeAddOn_PredicateNOT& PredicateNOT)
+{
+	const TArray<UFlowNodeAddOn*>& AddOns = PredicateNOT.GetFlowNodeAddOnChildren();
+
+	// For parity with PredicateAND, the "no AddOns (that qualify)" case results in a "true" result
+	if (AddOns.IsEmpty())
+	{
+		Ops.Add({EFlowPredicateOpCode::SetTrue});
+		return;
+	}
+
+	if (AddOns.Num() > 1)
+	{
+		PredicateNOT.LogError(FString::Printf(TEXT("%s may only have a single predicate AddOn child"), *PredicateNOT.GetName()));
+	}
+
+	const UFlowNodeAddOn* SingleChildAddOn = AddOns[0];
+	if (!IFlowPredicateInterface::ImplementsInterfaceSafe(SingleChildAddOn))
+	{
+		PredicateNOT.LogError(FString::Printf(TEXT("%s requires a child AddOn that implements the IFlowPredicateInterface interface!"), *PredicateNOT.GetName()));
+
+		Ops.Add({EFlowPredicateOpCode::SetTrue});
+		return;
+	}
+
+	EmitAddOn(*SingleChildAddOn);
+	Ops.Add({EFlowPredicateOpCode::Not});
+}
+
+int32 FFlowPredicateProgram::EmitJump(const EFlowPredicateOpCode OpCode)
+{
+	return Ops.Add({OpCode});
+}
+
+void FFlowPredicateProgram::PatchJumpsToEnd(TConstArrayView<int32> JumpOpIndices)
+{
+	const int32 EndIndex = Ops.Num();
+	for (const int32 JumpOpIndex : JumpOpIndices)
+	{
+		Ops[JumpOpIndex].JumpTarget = EndIndex;
+	}
+}
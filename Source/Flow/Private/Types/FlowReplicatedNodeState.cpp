@@ -0,0 +1,91 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "Types/FlowReplicatedNodeState.h"
+#include "FlowComponent.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FlowReplicatedNodeState)
+
+void FFlowReplicatedNodeState::PostReplicatedAdd(const FFlowReplicatedNodeStateArray& InArraySerializer)
+{
+	if (InArraySerializer.OwnerComponent)
+	{
+		InArraySerializer.OwnerComponent->BroadcastReplicatedNodeState(TemplateAsset, InstanceName, NodeIndex, State);
+	}
+}
+
+void FFlowReplicatedNodeState::PostReplicatedChange(const FFlowReplicatedNodeStateArray& InArraySerializer)
+{
+	if (InArraySerializer.OwnerComponent)
+	{
+		InArraySerializer.OwnerComponent->BroadcastReplicatedNodeState(TemplateAsset, InstanceName, NodeIndex, State);
+	}
+}
+
+void FFlowReplicatedNodeState::PreReplicatedRemove(const FFlowReplicatedNodeStateArray& InArraySerializer)
+{
+	if (InArraySerializer.OwnerComponent)
+	{
+		InArraySerializer.OwnerComponent->BroadcastReplicatedNodeState(TemplateAsset, InstanceName, NodeIndex, EFlowNodeState::NeverActivated);
+	}
+}
+
+const FFlowReplicatedNodeState* FFlowReplicatedNodeStateArray::Find(const FName InstanceName, const uint16 NodeIndex) const
+{
+	return Items.FindByPredicate([InstanceName, NodeIndex](const FFlowReplicatedNodeState& Item)
+	{
+		return Item.InstanceName == InstanceName && Item.NodeIndex == NodeIndex;
+	});
+}
+
+bool FFlowReplicatedNodeStateArray::SetState(UFlowAsset* TemplateAsset, const FName InstanceName, const uint16 NodeIndex, const EFlowNodeState State)
+{
+	const int32 ItemIndex = Items.IndexOfByPredicate([InstanceName, NodeIndex](const FFlowReplicatedNodeState& Item)
+	{
+		return Item.InstanceName == InstanceName && Item.NodeIndex == NodeIndex;
+	});
+
+	// nodes that were never activated aren't replicated at all
+	if (State == EFlowNodeState::NeverActivated)
+	{
+		if (ItemIndex != INDEX_NONE)
+		{
+			Items.RemoveAtSwap(ItemIndex);
+			MarkArrayDirty();
+			return true;
+		}
+
+		return false;
+	}
+
+	if (ItemIndex == INDEX_NONE)
+	{
+		MarkItemDirty(Items.Emplace_GetRef(TemplateAsset, InstanceName, NodeIndex, State));
+		return true;
+	}
+
+	FFlowReplicatedNodeState& Item = Items[ItemIndex];
+	if (Item.State != State)
+	{
+		Item.State = State;
+		MarkItemDirty(Item);
+		return true;
+	}
+
+	return false;
+}
+
+bool FFlowReplicatedNodeStateArray::RemoveAll(const FName InstanceName)
+{
+	const int32 RemovedCount = Items.RemoveAllSwap([InstanceName](const FFlowReplicatedNodeState& Item)
+	{
+		return Item.InstanceName == InstanceName;
+	});
+
+	if (RemovedCount > 0)
+	{
+		MarkArrayDirty();
+		return true;
+	}
+
+	return false;
+}
@@ -0,0 +1,225 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "Types/FlowSpatialGrid.h"
+#include "FlowComponent.h"
+
+FFlowSpatialGrid::FFlowSpatialGrid(const float InCellSize)
+	: CellSize(FMath::Max(InCellSize, 1.0f))
+	, MinCell(MAX_int32, MAX_int32)
+	, MaxCell(MIN_int32, MIN_int32)
+{
+}
+
+void FFlowSpatialGrid::Add(UFlowComponent* Component, const FVector& Location)
+{
+	if (Entries.Contains(Component))
+	{
+		Update(Component, Location);
+		return;
+	}
+
+	const FIntPoint Cell = GetCell(Location);
+	Entries.Add(Component, FEntry{Cell, Location});
+	AddToCell(Cell, Component);
+}
+
+void FFlowSpatialGrid::Update(UFlowComponent* Component, const FVector& Location)
+{
+	FEntry* Entry = Entries.Find(Component);
+	if (Entry == nullptr)
+	{
+		return;
+	}
+
+	Entry->Location = Location;
+
+	const FIntPoint NewCell = GetCell(Location);
+	if (NewCell != Entry->Cell)
+	{
+		RemoveFromCell(Entry->Cell, Component);
+		AddToCell(NewCell, Component);
+		Entry->Cell = NewCell;
+	}
+}
+
+void FFlowSpatialGrid::Remove(UFlowComponent* Component)
+{
+	FEntry Entry;
+	if (Entries.RemoveAndCopyValue(Component, Entry))
+	{
+		RemoveFromCell(Entry.Cell, Component);
+	}
+}
+
+void FFlowSpatialGrid::Reset()
+{
+	Cells.Empty();
+	Entries.Empty();
+
+	MinCell = FIntPoint(MAX_int32, MAX_int32);
+	MaxCell = FIntPoint(MIN_int32, MIN_int32);
+}
+
+void FFlowSpatialGrid::QuerySphere(const FVector& Center, const float Radius, FFilter Filter, TArray<UFlowComponent*>& OutComponents) const
+{
+	const FIntPoint FirstCell = GetCell(Center - FVector(Radius));
+	const FIntPoint LastCell = GetCell(Center + FVector(Radius));
+	const double RadiusSquared = FMath::Square(static_cast<double>(Radius));
+
+	for (int32 X = FirstCell.X; X <= LastCell.X; X++)
+	{
+		for (int32 Y = FirstCell.Y; Y <= LastCell.Y; Y++)
+		{
+			const TArray<TWeakObjectPtr<UFlowComponent>>* CellComponents = Cells.Find(FIntPoint(X, Y));
+			if (CellComponents == nullptr)
+			{
+				continue;
+			}
+
+			for (const TWeakObjectPtr<UFlowComponent>& Component : *CellComponents)
+			{
+				const FEntry& Entry = Entries.FindChecked(Component);
+				if (FVector::DistSquared(Entry.Location, Center) <= RadiusSquared && Component.IsValid() && Filter(*Component))
+				{
+					OutComponents.Emplace(Component.Get());
+				}
+			}
+		}
+	}
+}
+
+void FFlowSpatialGrid::QueryBox(const FBox& Bounds, FFilter Filter, TArray<UFlowComponent*>& OutComponents) const
+{
+	if (!Bounds.IsValid)
+	{
+		return;
+	}
+
+	const FIntPoint FirstCell = GetCell(Bounds.Min);
+	const FIntPoint LastCell = GetCell(Bounds.Max);
+
+	for (int32 X = FirstCell.X; X <= LastCell.X; X++)
+	{
+		for (int32 Y = FirstCell.Y; Y <= LastCell.Y; Y++)
+		{
+			const TArray<TWeakObjectPtr<UFlowComponent>>* CellComponents = Cells.Find(FIntPoint(X, Y));
+			if (CellComponents == nullptr)
+			{
+				continue;
+			}
+
+			for (const TWeakObjectPtr<UFlowComponent>& Component : *CellComponents)
+			{
+				const FEntry& Entry = Entries.FindChecked(Component);
+				if (Bounds.IsInsideOrOn(Entry.Location) && Component.IsValid() && Filter(*Component))
+				{
+					OutComponents.Emplace(Component.Get());
+				}
+			}
+		}
+	}
+}
+
+UFlowComponent* FFlowSpatialGrid::FindNearest(const FVector& Location, const float MaxDistance, FFilter Filter) const
+{
+	if (Entries.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	const FIntPoint Center = GetCell(Location);
+
+	// rings beyond the occupied extent are empty
+	const FIntPoint ToMin = Center - MinCell;
+	const FIntPoint ToMax = MaxCell - Center;
+	const int64 ExtentRing = FMath::Max(FMath::Max(FMath::Abs<int64>(ToMin.X), FMath::Abs<int64>(ToMin.Y)), FMath::Max(FMath::Abs<int64>(ToMax.X), FMath::Abs<int64>(ToMax.Y)));
+	const int64 MaxRing = MaxDistance > 0.0f ? FMath::Min(ExtentRing, static_cast<int64>(FMath::CeilToDouble(MaxDistance / CellSize))) : ExtentRing;
+
+	UFlowComponent* Nearest = nullptr;
+	double NearestDistanceSquared = MaxDistance > 0.0f ? FMath::Square(static_cast<double>(MaxDistance)) : TNumericLimits<double>::Max();
+
+	auto VisitComponents = [&](const TArray<TWeakObjectPtr<UFlowComponent>>& CellComponents)
+	{
+		for (const TWeakObjectPtr<UFlowComponent>& Component : CellComponents)
+		{
+			const double DistanceSquared = FVector::DistSquared(Entries.FindChecked(Component).Location, Location);
+			if (DistanceSquared <= NearestDistanceSquared && Component.IsValid() && Filter(*Component))
+			{
+				Nearest = Component.Get();
+				NearestDistanceSquared = DistanceSquared;
+			}
+		}
+	};
+
+	// sparse grid or unlimited distance, visiting (2 * MaxRing + 1)^2 cells would cost more than checking every occupied one
+	if (MaxDistance <= 0.0f || FMath::Square(2 * MaxRing + 1) > Cells.Num())
+	{
+		for (const TPair<FIntPoint, TArray<TWeakObjectPtr<UFlowComponent>>>& Cell : Cells)
+		{
+			VisitComponents(Cell.Value);
+		}
+
+		return Nearest;
+	}
+
+	auto VisitCell = [&](const FIntPoint& Cell)
+	{
+		if (const TArray<TWeakObjectPtr<UFlowComponent>>* CellComponents = Cells.Find(Cell))
+		{
+			VisitComponents(*CellComponents);
+		}
+	};
+
+	for (int32 Ring = 0; Ring <= static_cast<int32>(MaxRing); Ring++)
+	{
+		// components in further rings are at least this far on the XY plane
+		if (Nearest && FMath::Square(static_cast<double>(Ring - 1) * CellSize) > NearestDistanceSquared)
+		{
+			break;
+		}
+
+		if (Ring == 0)
+		{
+			VisitCell(Center);
+			continue;
+		}
+
+		for (int32 Offset = -Ring; Offset <= Ring; Offset++)
+		{
+			VisitCell(FIntPoint(Center.X + Offset, Center.Y - Ring));
+			VisitCell(FIntPoint(Center.X + Offset, Center.Y + Ring));
+		}
+		for (int32 Offset = -Ring + 1; Offset <= Ring - 1; Offset++)
+		{
+			VisitCell(FIntPoint(Center.X - Ring, Center.Y + Offset));
+			VisitCell(FIntPoint(Center.X + Ring, Center.Y + Offset));
+		}
+	}
+
+	return Nearest;
+}
+
+FIntPoint FFlowSpatialGrid::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+void FFlowSpatialGrid::AddToCell(const FIntPoint& Cell, UFlowComponent* Component)
+{
+	Cells.FindOrAdd(Cell).Emplace(Component);
+
+	MinCell = FIntPoint(FMath::Min(MinCell.X, Cell.X), FMath::Min(MinCell.Y, Cell.Y));
+	MaxCell = FIntPoint(FMath::Max(MaxCell.X, Cell.X), FMath::Max(MaxCell.Y, Cell.Y));
+}
+
+void FFlowSpatialGrid::RemoveFromCell(const FIntPoint& Cell, UFlowComponent* Component)
+{
+	if (TArray<TWeakObjectPtr<UFlowComponent>>* CellComponents = Cells.Find(Cell))
+	{
+		CellComponents->RemoveSwap(Component);
+		if (CellComponents->Num() == 0)
+		{
+			Cells.Remove(Cell);
+		}
+	}
+}
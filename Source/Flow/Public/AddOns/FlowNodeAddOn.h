@@ -95,3 +95,92 @@ protected:
 	TArray<FFlowPin> GetPinsForContext(const TArray<FFlowPin>& Context) const;
 #endif
 };
+
+//////////////////////////////////////////////////////////////////////////
+// UFlowNodeBase AddOn traversal
+
+template <typename TFunctionType>
+EFlowForEachAddOnFunctionReturnValue UFlowNodeBase::ForEachAddOnInline(TFunctionType&& Function, const EFlowForEachAddOnChildRule AddOnChildRule) const
+{
+	FLOW_ASSERT_ENUM_MAX(EFlowForEachAddOnFunctionReturnValue, 3);
+	FLOW_ASSERT_ENUM_MAX(EFlowForEachAddOnChildRule, 2);
+
+	EFlowForEachAddOnFunctionReturnValue ReturnValue = EFlowForEachAddOnFunctionReturnValue::Continue;
+
+	const bool bAllChildren = AddOnChildRule == EFlowForEachAddOnChildRule::AllChildren;
+	if (bAllChildren && !FlattenedAddOns.IsEmpty())
+	{
+		// Iterating by index, as the Function might deinitialize this instance
+		for (int32 Index = 0; Index < FlattenedAddOns.Num(); ++Index)
+		{
+			UFlowNodeAddOn* AddOn = FlattenedAddOns[Index];
+			if (!IsValid(AddOn))
+			{
+				continue;
+			}
+
+			ReturnValue = Function(*AddOn);
+
+			if (!EFlowForEachAddOnFunctionReturnValue_Classifiers::ShouldContinueForEach(ReturnValue))
+			{
+				break;
+			}
+		}
+
+		return ReturnValue;
+	}
+
+	for (UFlowNodeAddOn* AddOn : AddOns)
+	{
+		if (!IsValid(AddOn))
+		{
+			continue;
+		}
+
+		ReturnValue = Function(*AddOn);
+
+		if (!EFlowForEachAddOnFunctionReturnValue_Classifiers::ShouldContinueForEach(ReturnValue))
+		{
+			break;
+		}
+
+		if (bAllChildren)
+		{
+			ReturnValue = AddOn->ForEachAddOnInline(Function);
+
+			if (!EFlowForEachAddOnFunctionReturnValue_Classifiers::ShouldContinueForEach(ReturnValue))
+			{
+				break;
+			}
+		}
+	}
+
+	return ReturnValue;
+}
+
+template <typename TFunctionType>
+EFlowForEachAddOnFunctionReturnValue UFlowNodeBase::ForEachAddOnConstInline(TFunctionType&& Function, const EFlowForEachAddOnChildRule AddOnChildRule) const
+{
+	return ForEachAddOnInline(
+		[&Function](const UFlowNodeAddOn& AddOn)
+		{
+			return Function(AddOn);
+		},
+		AddOnChildRule);
+}
+
+template <typename TFunctionType>
+EFlowForEachAddOnFunctionReturnValue UFlowNodeBase::ForEachAddOnForClassInline(const UClass& InterfaceOrClass, TFunctionType&& Function, const EFlowForEachAddOnChildRule AddOnChildRule) const
+{
+	return ForEachAddOnInline(
+		[&InterfaceOrClass, &Function](UFlowNodeAddOn& AddOn)
+		{
+			if (AddOn.IsClassOrImplementsInterface(InterfaceOrClass))
+			{
+				return Function(AddOn);
+			}
+
+			return EFlowForEachAddOnFunctionReturnValue::Continue;
+		},
+		AddOnChildRule);
+}
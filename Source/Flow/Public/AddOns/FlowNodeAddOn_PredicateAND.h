@@ -4,6 +4,7 @@
 
 #include "AddOns/FlowNodeAddOn.h"
 #include "Interfaces/FlowPredicateInterface.h"
+#include "Types/FlowPredicateProgram.h"
 
 #include "FlowNodeAddOn_PredicateAND.generated.h"
 
@@ -20,6 +21,11 @@ class UFlowNodeAddOn_PredicateAND
 public:
 	UFlowNodeAddOn_PredicateAND();
 
+	// IFlowCoreExecutableInterface
+	virtual void InitializeInstance() override;
+	virtual void DeinitializeInstance() override;
+	// --
+
 	// UFlowNodeBase
 	virtual EFlowAddOnAcceptResult AcceptFlowNodeAddOnChild_Implementation(const UFlowNodeAddOn* AddOnTemplate, const TArray<UFlowNodeAddOn*>& AdditionalAddOnsToAssumeAreChildren) const override;
 	// --
@@ -29,4 +35,8 @@ public:
 	// --
 
 	FLOW_API static bool EvaluatePredicateAND(const TArray<UFlowNodeAddOn*>& AddOns);
+
+protected:
+	// Child predicate tree flattened on instance initialization
+	FFlowPredicateProgram PredicateProgram;
 };
@@ -4,6 +4,7 @@
 
 #include "AddOns/FlowNodeAddOn.h"
 #include "Interfaces/FlowPredicateInterface.h"
+#include "Types/FlowPredicateProgram.h"
 
 #include "FlowNodeAddOn_PredicateNOT.generated.h"
 
@@ -20,6 +21,11 @@ class UFlowNodeAddOn_PredicateNOT
 public:
 	UFlowNodeAddOn_PredicateNOT();
 
+	// IFlowCoreExecutableInterface
+	virtual void InitializeInstance() override;
+	virtual void DeinitializeInstance() override;
+	// --
+
 	// UFlowNodeBase
 	virtual EFlowAddOnAcceptResult AcceptFlowNodeAddOnChild_Implementation(const UFlowNodeAddOn* AddOnTemplate, const TArray<UFlowNodeAddOn*>& AdditionalAddOnsToAssumeAreChildren) const override;
 	// --
@@ -27,4 +33,8 @@ public:
 	// IFlowPredicateInterface
 	virtual bool EvaluatePredicate_Implementation() const override;
 	// --
+
+protected:
+	// Child predicate tree flattened on instance initialization
+	FFlowPredicateProgram PredicateProgram;
 };
@@ -4,6 +4,7 @@
 
 #include "AddOns/FlowNodeAddOn.h"
 #include "Interfaces/FlowPredicateInterface.h"
+#include "Types/FlowPredicateProgram.h"
 
 #include "FlowNodeAddOn_PredicateOR.generated.h"
 
@@ -20,6 +21,11 @@ class UFlowNodeAddOn_PredicateOR
 public:
 	UFlowNodeAddOn_PredicateOR();
 
+	// IFlowCoreExecutableInterface
+	virtual void InitializeInstance() override;
+	virtual void DeinitializeInstance() override;
+	// --
+
 	// UFlowNodeBase
 	virtual EFlowAddOnAcceptResult AcceptFlowNodeAddOnChild_Implementation(const UFlowNodeAddOn* AddOnTemplate, const TArray<UFlowNodeAddOn*>& AdditionalAddOnsToAssumeAreChildren) const override;
 	// --
@@ -29,4 +35,8 @@ public:
 	// --
 
 	FLOW_API static bool EvaluatePredicateOR(const TArray<UFlowNodeAddOn*>& AddOns);
+
+protected:
+	// Child predicate tree flattened on instance initialization
+	FFlowPredicateProgram PredicateProgram;
 };
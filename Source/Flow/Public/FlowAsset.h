@@ -57,6 +57,33 @@ struct FFlowHarvestDataPinsWorkingData
 	bool bPinNameMapChanged = false;
 };
 
+// Runtime lookup tables precomputed while cooking, so cooked assets don't rediscover their structure by iterating all nodes
+// Used only in cooked builds, editor always looks up the nodes as these change while editing
+// Not a property of the asset, it's written after tagged properties of cooked packages only
+USTRUCT()
+struct FLOW_API FFlowAssetCookedData
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	bool bValid = false;
+
+	UPROPERTY()
+	FGuid DefaultEntryNodeGuid;
+
+	UPROPERTY()
+	TMap<FName, FGuid> CustomInputNodeGuids;
+
+	UPROPERTY()
+	TMap<FName, FGuid> CustomOutputNodeGuids;
+
+	// Sorted keys of the Nodes map, see UFlowAsset::GetNodeReplicationIndex
+	UPROPERTY()
+	TArray<FGuid> SortedNodeGuids;
+
+	void Reset() { *this = FFlowAssetCookedData(); }
+};
+
 /**
  * Single asset containing flow nodes.
  */
@@ -78,6 +105,8 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Flow Asset")
 	FGuid AssetGuid;
 
+	virtual void Serialize(FArchive& Ar) override;
+
 	// Set it to False, if this asset is instantiated as Root Flow for owner that doesn't live in the world
 	// This allows to SaveGame support works properly, if owner of Root Flow would be Game Instance or its subsystem
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Flow Asset")
@@ -96,6 +125,10 @@ public:
 	virtual void PostDuplicate(bool bDuplicateForPIE) override;
 	virtual void PostLoad() override;
 	// --
+
+protected:
+	// Computed from nodes while saving the cooked package, the asset itself isn't modified
+	void BuildCookedData(FFlowAssetCookedData& OutCookedData) const;
 #endif	
 
 #if WITH_EDITORONLY_DATA
@@ -144,6 +177,9 @@ private:
 	UPROPERTY()
 	TMap<FGuid, TObjectPtr<UFlowNode>> Nodes;
 
+	// Serialized only in cooked packages, see Serialize
+	FFlowAssetCookedData CookedData;
+
 #if WITH_EDITORONLY_DATA
 protected:
 	/**
@@ -173,6 +209,14 @@ public:
 	// Processes nodes and updates pin connections from the graph to the UFlowNode (processes all nodes in the graph if passed nullptr)
 	void HarvestNodeConnections(UFlowNode* TargetNode = nullptr);
 
+	// Marks node connections to be harvested by HarvestDirtyNodeConnections, i.e. after node's pins or links changed
+	void MarkNodeConnectionsDirty(const FGuid& NodeGuid) { DirtyConnectionNodes.Add(NodeGuid); }
+	void MarkAllNodeConnectionsDirty() { bAllNodeConnectionsDirty = true; }
+
+	// Harvests connections only for nodes marked dirty since the last harvest, does nothing if no pins changed
+	void HarvestDirtyNodeConnections();
+	bool HasDirtyNodeConnections() const { return bAllNodeConnectionsDirty || !DirtyConnectionNodes.IsEmpty(); }
+
 	// Updates the auto-generated pins and bindings for a given FlowNode,
 	// returns true if any changes were made.
 	bool TryUpdateManagedFlowPinsForNode(UFlowNode& FlowNode);
@@ -193,10 +237,28 @@ protected:
 	void HarvestFlowPinMetadataForProperty(const FProperty* Property, FFlowHarvestDataPinsWorkingData& InOutData);
 #endif
 
+private:
+#if WITH_EDITORONLY_DATA
+	// Asset might have been saved before node definitions changed, so all connections are harvested once after load
+	bool bAllNodeConnectionsDirty = true;
+
+	TSet<FGuid> DirtyConnectionNodes;
+#endif
+
+	// Node guids in sorted order, built on demand, see GetNodeReplicationIndex
+	mutable TArray<FGuid> SortedNodeGuids;
+
+	const TArray<FGuid>& GetSortedNodeGuids() const;
+
 public:
 	const TMap<FGuid, UFlowNode*>& GetNodes() const { return ObjectPtrDecay(Nodes); }
 	UFlowNode* GetNode(const FGuid& Guid) const { return Nodes.FindRef(Guid); }
 
+	// Index of the node that is identical on the server and clients, used to replicate node states compactly
+	// Returns INDEX_NONE if the node doesn't belong to this asset
+	int32 GetNodeReplicationIndex(const FGuid& Guid) const;
+	UFlowNode* GetNodeByReplicationIndex(const int32 Index) const;
+
 	template <class T>
 	T* GetNode(const FGuid& Guid) const
 	{
@@ -288,11 +350,17 @@ private:
 
 public:
 	void AddInstance(UFlowAsset* Instance);
+	void ReserveInstances(const int32 AdditionalInstances);
 	int32 RemoveInstance(UFlowAsset* Instance);
 
 	void ClearInstances();
 	int32 GetInstancesNum() const { return ActiveInstances.Num(); }
 
+#if !UE_BUILD_SHIPPING
+	// Adds memory allocated by this asset and its nodes, see UFlowSubsystem::GatherMemoryFootprint
+	void GetMemoryFootprint(FFlowMemoryFootprint& OutFootprint) const;
+#endif
+
 #if WITH_EDITOR
 	void GetInstanceDisplayNames(TArray<TSharedPtr<FName>>& OutDisplayNames) const;
 
@@ -397,6 +465,9 @@ protected:
 	void FinishNode(UFlowNode* Node);
 	void ResetNodes();
 
+	// Passes node state to the Flow Component owning this Root Flow instance, so it can be replicated to clients
+	void OnNodeActivationStateChanged(const UFlowNode& Node) const;
+
 #if !UE_BUILD_SHIPPING
 public:	
 	FFlowSignalEvent OnPinTriggered;
@@ -8,20 +8,22 @@
 #include "FlowSave.h"
 #include "FlowTypes.h"
 #include "Interfaces/FlowOwnerInterface.h"
+#include "Types/FlowReplicatedNodeState.h"
 #include "FlowComponent.generated.h"
 
 class UFlowAsset;
+class UFlowNode;
 class UFlowSubsystem;
 
-USTRUCT()
+USTRUCT(BlueprintType)
 struct FNotifyTagReplication
 {
 	GENERATED_BODY()
 
-	UPROPERTY()
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Flow")
 	FGameplayTag ActorTag;
 
-	UPROPERTY()
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Flow")
 	FGameplayTag NotifyTag;
 
 	FNotifyTagReplication() {}
@@ -33,8 +35,63 @@ struct FNotifyTagReplication
 	}
 };
 
+UENUM()
+enum class EFlowNotifyChannel : uint8
+{
+	SentToGraph,			// NotifyGraph, BulkNotifyGraph
+	FromGraph,				// NotifyFromGraph, UFlowSubsystem::BulkNotifyActors
+	FromAnotherComponent,	// NotifyActor
+
+	Max UMETA(Hidden),
+	Invalid UMETA(Hidden),
+	Min = 0 UMETA(Hidden),
+};
+FLOW_ENUM_RANGE_VALUES(EFlowNotifyChannel)
+
+// Single notify call queued for replication, preserving the tags sent together in one call
+USTRUCT()
+struct FFlowQueuedNotify
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	EFlowNotifyChannel Channel = EFlowNotifyChannel::SentToGraph;
+
+	// Only used by EFlowNotifyChannel::FromAnotherComponent
+	UPROPERTY()
+	FGameplayTag ActorTag;
+
+	UPROPERTY()
+	FGameplayTagContainer NotifyTags;
+
+	FFlowQueuedNotify() {}
+
+	FFlowQueuedNotify(const EFlowNotifyChannel InChannel, const FGameplayTag& InActorTag, const FGameplayTagContainer& InNotifyTags)
+		: Channel(InChannel)
+		, ActorTag(InActorTag)
+		, NotifyTags(InNotifyTags)
+	{
+	}
+};
+
+// All notifies sent between two net updates of the owning actor, replicated as a single ordered delta
+USTRUCT()
+struct FFlowNotifyBatch
+{
+	GENERATED_BODY()
+
+	// Incremented for every new batch, so identical consecutive batches still trigger OnRep on clients
+	UPROPERTY()
+	uint16 BatchId = 0;
+
+	UPROPERTY()
+	TArray<FFlowQueuedNotify> Notifies;
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FFlowComponentTagsReplicated, class UFlowComponent*, FlowComponent, const FGameplayTagContainer&, CurrentTags);
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FiveParams(FFlowComponentNodeStateReplicated, class UFlowComponent*, FlowComponent, UFlowAsset*, TemplateAsset, FName, InstanceName, UFlowNode*, TemplateNode, EFlowNodeState, State);
+
 DECLARE_MULTICAST_DELEGATE_TwoParams(FFlowComponentNotify, class UFlowComponent*, const FGameplayTag&);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FFlowComponentDynamicNotify, class UFlowComponent*, FlowComponent, const FGameplayTag&, NotifyTag);
 
@@ -49,6 +106,7 @@ class FLOW_API UFlowComponent : public UActorComponent, public IFlowOwnerInterfa
 	friend class UFlowSubsystem;
 	
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
 	
 //////////////////////////////////////////////////////////////////////////
 // Identity Tags
@@ -99,7 +157,7 @@ public:
 
 private:
 	// Stores only recently sent tags
-	UPROPERTY(ReplicatedUsing = OnRep_SentNotifyTags)
+	UPROPERTY()
 	FGameplayTagContainer RecentlySentNotifyTags;
 
 public:
@@ -116,8 +174,7 @@ public:
 	void BulkNotifyGraph(const FGameplayTagContainer NotifyTags, const EFlowNetMode NetMode = EFlowNetMode::Authority);
 
 private:
-	UFUNCTION()
-	void OnRep_SentNotifyTags();
+	void BroadcastSentNotifyTags();
 
 public:
 	FFlowComponentNotify OnNotifyFromComponent;
@@ -125,19 +182,9 @@ public:
 //////////////////////////////////////////////////////////////////////////
 // Component receiving Notify Tags from Flow Graph
 
-private:
-	// Stores only recently replicated tags
-	UPROPERTY(ReplicatedUsing = OnRep_NotifyTagsFromGraph)
-	FGameplayTagContainer NotifyTagsFromGraph;
-
 public:
 	virtual void NotifyFromGraph(const FGameplayTagContainer& NotifyTags, const EFlowNetMode NetMode = EFlowNetMode::Authority);
 
-private:
-	UFUNCTION()
-	void OnRep_NotifyTagsFromGraph();
-
-public:
 	// Receive notification from Flow graph or another Flow Component
 	UPROPERTY(BlueprintAssignable, Category = "Flow")
 	FFlowComponentDynamicNotify ReceiveNotify;
@@ -145,19 +192,31 @@ public:
 //////////////////////////////////////////////////////////////////////////
 // Sending Notify Tags between Flow components
 
-private:
-	// Stores only recently replicated tags
-	UPROPERTY(ReplicatedUsing = OnRep_NotifyTagsFromAnotherComponent)
-	TArray<FNotifyTagReplication> NotifyTagsFromAnotherComponent;
-
 public:
 	// Send notification to another actor containing Flow Component
 	UFUNCTION(BlueprintCallable, Category = "Flow")
 	virtual void NotifyActor(const FGameplayTag ActorTag, const FGameplayTag NotifyTag, const EFlowNetMode NetMode = EFlowNetMode::Authority);
 
 private:
+	void BroadcastNotifyToActors(const FGameplayTag& ActorTag, const FGameplayTag& NotifyTag);
+
+//////////////////////////////////////////////////////////////////////////
+// Notify replication
+
+private:
+	// Notifies sent since the last net update of the owning actor
+	// Replaces replicating only the most recent notify, which lost all but the last notify sent within a single net update
+	UPROPERTY(ReplicatedUsing = OnRep_NotifyBatch)
+	FFlowNotifyBatch NotifyBatch;
+
+	// Set by PreReplication once the current batch has been handed over to the replication system
+	bool bNotifyBatchReplicated;
+
+	// Queues notify for replication, called only on the server
+	void EnqueueReplicatedNotify(const EFlowNotifyChannel Channel, const FGameplayTag& ActorTag, const FGameplayTagContainer& NotifyTags);
+
 	UFUNCTION()
-	void OnRep_NotifyTagsFromAnotherComponent();
+	void OnRep_NotifyBatch();
 
 //////////////////////////////////////////////////////////////////////////
 // Root Flow
@@ -197,6 +256,48 @@ public:
 	UFUNCTION(BlueprintPure, Category = "RootFlow", meta = (DeprecatedFunction, DeprecationMessage="Use GetRootInstances() instead."))
 	UFlowAsset* GetRootFlowInstance() const;
 
+//////////////////////////////////////////////////////////////////////////
+// Replicated Root Flow node states
+
+public:
+	// If true, active and finished nodes of Root Flow instances started by this component are replicated to clients
+	// This allows client-side UI to reflect graph progress without running the graph on clients
+	// Node states are keyed by the instance name, so every instance of the given Root Flow is mirrored separately
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "RootFlow")
+	bool bReplicateRootFlowNodeStates;
+
+	// Called whenever node state changes, on the server and on clients receiving replicated states
+	// Template node is passed, as clients might not have the Root Flow instance at all
+	UPROPERTY(BlueprintAssignable, Category = "RootFlow")
+	FFlowComponentNodeStateReplicated OnRootFlowNodeStateChanged;
+
+	// Returns names of Root Flow instances of given template that have replicated node states
+	UFUNCTION(BlueprintPure, Category = "RootFlow")
+	TArray<FName> GetReplicatedInstanceNames(const UFlowAsset* TemplateAsset) const;
+
+	// Returns node state replicated from the server, NeverActivated if the node wasn't activated yet
+	// None instance name checks all instances of the template, Active is returned if the node is active in any of them
+	UFUNCTION(BlueprintPure, Category = "RootFlow")
+	EFlowNodeState GetReplicatedNodeState(const UFlowAsset* TemplateAsset, const FGuid& NodeGuid, const FName InstanceName = NAME_None) const;
+
+	// Returns template nodes that are currently active on the server
+	// None instance name returns nodes active in any instance of the template
+	UFUNCTION(BlueprintPure, Category = "RootFlow")
+	TArray<UFlowNode*> GetReplicatedActiveNodes(const UFlowAsset* TemplateAsset, const FName InstanceName = NAME_None) const;
+
+	// UFlowAsset-only access
+	void UpdateReplicatedNodeState(const UFlowAsset& RootFlowInstance, const UFlowNode& Node);
+	void RemoveReplicatedNodeStates(const UFlowAsset& RootFlowInstance);
+	// ---
+
+	// FFlowReplicatedNodeStateArray-only access
+	void BroadcastReplicatedNodeState(UFlowAsset* TemplateAsset, const FName InstanceName, const uint16 NodeIndex, const EFlowNodeState State);
+	// ---
+
+private:
+	UPROPERTY(Replicated)
+	FFlowReplicatedNodeStateArray ReplicatedNodeStates;
+
 //////////////////////////////////////////////////////////////////////////
 // Custom Input and Output events
 
@@ -0,0 +1,51 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "Engine/DataAsset.h"
+#include "UObject/SoftObjectPtr.h"
+#include "FlowPreloadManifest.generated.h"
+
+class UFlowAsset;
+
+/**
+ * List of Flow Asset templates expected to be used by a map or the whole game
+ * Flow Subsystem loads them asynchronously, i.e. during a loading screen, so the first use of template doesn't hitch
+ * Assign it to Flow World Settings (per map) or Flow Settings (per game), or pass it to UFlowSubsystem::PreloadManifest
+ */
+UCLASS(BlueprintType)
+class FLOW_API UFlowPreloadManifest : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Preload")
+	TArray<TSoftObjectPtr<UFlowAsset>> Templates;
+
+	// Follow Flow Assets referenced by nodes of preloaded templates, i.e. assets of Sub Graph nodes
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Preload")
+	bool bPreloadSubGraphs = true;
+
+	// Load other content softly referenced by nodes of preloaded templates, i.e. level sequences
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Preload")
+	bool bPreloadNodeContent = true;
+
+#if WITH_EDITORONLY_DATA
+	// Maps scanned by Gather From Source Maps
+	UPROPERTY(EditAnywhere, Category = "Generation")
+	TArray<TSoftObjectPtr<UWorld>> SourceMaps;
+#endif
+
+#if WITH_EDITOR
+	// Adds Flow Assets found in dependencies of Source Maps, including assets referenced by Blueprints and other Flow Assets
+	UFUNCTION(CallInEditor, Category = "Generation")
+	void GatherFromSourceMaps();
+
+	// Adds templates instanced since the editor started, i.e. during PIE sessions playing through the content
+	UFUNCTION(CallInEditor, Category = "Generation")
+	void GatherFromRecordedUsage();
+
+private:
+	void AddTemplates(const TArray<FSoftObjectPath>& TemplatePaths);
+#endif
+};
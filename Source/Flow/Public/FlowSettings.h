@@ -5,9 +5,11 @@
 #include "Engine/DeveloperSettings.h"
 #include "Templates/SubclassOf.h"
 #include "UObject/SoftObjectPath.h"
+#include "UObject/SoftObjectPtr.h"
 #include "FlowSettings.generated.h"
 
 class UFlowNode;
+class UFlowPreloadManifest;
 
 /**
  *
@@ -39,6 +41,35 @@ class FLOW_API UFlowSettings : public UDeveloperSettings
 	UPROPERTY(Config, EditAnywhere, Category = "Flow")
 	bool bLogOnSignalPassthrough;
 
+	// Max number of Level Sequence Actors kept for reuse by Play Level Sequence nodes, per sequence and per world
+	// Set it to 0 to disable pooling, actors will be destroyed after playback
+	UPROPERTY(Config, EditAnywhere, Category = "LevelSequence", meta = (ClampMin = 0))
+	int32 MaxPooledLevelSequenceActors;
+
+	// If enabled, "stat flow" and CSV captures report execution cost per node class
+	// Dynamic stats have a cost, so keep it disabled outside of profiling sessions
+	UPROPERTY(Config, EditAnywhere, Category = "Profiling")
+	bool bEnableNodeClassStatScopes;
+
+	// If enabled, Flow Subsystem keeps registered components in a spatial grid, updated as their owners move
+	// Spatial queries work without it, but then they check the location of every component matching the tag
+	UPROPERTY(Config, EditAnywhere, Category = "ComponentRegistry")
+	bool bEnableSpatialComponentQueries;
+
+	// Size of a spatial grid cell, ideally close to the typical radius of spatial queries
+	UPROPERTY(Config, EditAnywhere, Category = "ComponentRegistry", meta = (ClampMin = 100.0f, Units = "cm", EditCondition = "bEnableSpatialComponentQueries"))
+	float SpatialQueryCellSize;
+
+	// If enabled, all Flow Components of a streaming level being removed from the world are unregistered in one pass
+	// Their root flows are finished at once, and a single OnLevelComponentsUnregistered event replaces per-component OnComponentUnregistered
+	UPROPERTY(Config, EditAnywhere, Category = "ComponentRegistry")
+	bool bBulkUnregisterOnLevelRemoval;
+
+	// Templates used everywhere in the game, loaded asynchronously as soon as Flow Subsystem is initialized
+	// Templates specific to a map can be listed in the Preload Manifest of Flow World Settings
+	UPROPERTY(Config, EditAnywhere, Category = "Preload")
+	TSoftObjectPtr<UFlowPreloadManifest> DefaultPreloadManifest;
+
 	// Adjust the Titles for FlowNodes to be more expressive than default
 	// by incorporating data that would otherwise go in the Description
 	UPROPERTY(EditAnywhere, config, Category = "Nodes")
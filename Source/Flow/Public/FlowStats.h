@@ -0,0 +1,71 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "Misc/Optional.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+#include "UObject/Object.h"
+
+DECLARE_STATS_GROUP(TEXT("Flow"), STATGROUP_Flow, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Execute Input"), STAT_FlowExecuteInput, STATGROUP_Flow, FLOW_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Initialize Instance"), STAT_FlowInitializeInstance, STATGROUP_Flow, FLOW_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Resolve Data Pin"), STAT_FlowResolveDataPin, STATGROUP_Flow, FLOW_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Node Activations"), STAT_FlowNodeActivations, STATGROUP_Flow, FLOW_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Active Instances"), STAT_FlowActiveInstances, STATGROUP_Flow, FLOW_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Active Nodes"), STAT_FlowActiveNodes, STATGROUP_Flow, FLOW_API);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(FLOW_API, Flow);
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(FLOW_API, FlowNodeClasses);
+
+// Placed at the top of every TryResolveDataPinAs...() function
+#define FLOW_SCOPE_RESOLVE_DATA_PIN() \
+	SCOPE_CYCLE_COUNTER(STAT_FlowResolveDataPin); \
+	CSV_SCOPED_TIMING_STAT(Flow, ResolveDataPin)
+
+/**
+ * Counters shared by "stat flow" and CSV captures. Updated on the game thread only.
+ */
+struct FLOW_API FFlowStats
+{
+	static void OnInstanceInitialized();
+	static void OnInstanceDeinitialized();
+
+	static void OnNodeActivated();
+	static void OnNodeDeactivated();
+
+	// Node loaded from SaveGame as active, counted as active without being activated again
+	static void OnNodeRestored();
+
+private:
+	static void UpdateActiveCounters();
+
+	static int32 ActiveInstances;
+	static int32 ActiveNodes;
+};
+
+/**
+ * Attributes execution cost to the class of executed node or AddOn, so "stat flow" and CSV captures can tell node types apart.
+ * Does nothing unless UFlowSettings::bEnableNodeClassStatScopes is set, as dynamic stats aren't free.
+ * Timings are inclusive of nodes triggered synchronously downstream.
+ */
+class FLOW_API FFlowNodeClassStatScope
+{
+public:
+	explicit FFlowNodeClassStatScope(const UObject& NodeOrAddOn);
+	~FFlowNodeClassStatScope();
+
+private:
+#if STATS
+	// Stat id per node class, created on first use in STATGROUP_Flow
+	static TStatId GetClassStatId(const UClass& Class);
+
+	TOptional<FScopeCycleCounter> CycleCounter;
+#endif
+
+#if CSV_PROFILER
+	FName CsvStatName;
+#endif
+};
@@ -2,22 +2,78 @@
 
 #pragma once
 
+#include "Components/SceneComponent.h"
+#include "Engine/StreamableManager.h"
 #include "GameFramework/Actor.h"
 #include "GameplayTagContainer.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "UObject/ObjectKey.h"
 
 #include "FlowComponent.h"
+#include "Types/FlowMemoryFootprint.h"
+#include "Types/FlowSpatialGrid.h"
 #include "FlowSubsystem.generated.h"
 
 class UFlowAsset;
 class UFlowNode_SubGraph;
+class UFlowPreloadManifest;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FSimpleFlowEvent);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSimpleFlowComponentEvent, UFlowComponent*, Component);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FTaggedFlowComponentEvent, UFlowComponent*, Component, const FGameplayTagContainer&, Tags);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FLevelFlowComponentsEvent, ULevel*, Level, const TArray<UFlowComponent*>&, Components);
 
 DECLARE_DELEGATE_OneParam(FNativeFlowAssetEvent, class UFlowAsset*);
 
+/* Flow Components registered under the same tag, having the exact same component class and owner class */
+struct FFlowComponentClassPartition
+{
+	const UClass* ComponentClass;
+	const UClass* OwnerClass;
+	TArray<TWeakObjectPtr<UFlowComponent>> Components;
+
+	FFlowComponentClassPartition(const UClass* InComponentClass, const UClass* InOwnerClass)
+		: ComponentClass(InComponentClass)
+		, OwnerClass(InOwnerClass)
+	{
+	}
+};
+
+/* Registry and instance data of a single world, dropped in one step when the world is cleaned up */
+struct FFlowWorldPartition
+{
+	/* Components registered in this world */
+	TSet<TWeakObjectPtr<UFlowComponent>> Components;
+
+	/* Same components grouped by level of their owner, so a whole level can be unregistered at once */
+	TMap<TObjectKey<ULevel>, TSet<TWeakObjectPtr<UFlowComponent>>> ComponentsByLevel;
+
+	/* Mirrors FlowComponentRegistry, so class-filtered queries check class once per partition instead of casting every tagged component
+	 * Partitions are removed as soon as they're empty, so classes aren't referenced after their last component unregistered */
+	TMap<FGameplayTag, TArray<FFlowComponentClassPartition>> ClassPartitionedRegistry;
+
+	/* Root instances owned by objects in this world */
+	TSet<TWeakObjectPtr<UFlowAsset>> RootInstances;
+
+	/* Registered components by location of their owner, valid only if UFlowSettings::bEnableSpatialComponentQueries is set */
+	TUniquePtr<FFlowSpatialGrid> SpatialGrid;
+
+	/* Root components of movable owners, observed to keep the spatial grid up to date */
+	TMap<TWeakObjectPtr<UFlowComponent>, TPair<TWeakObjectPtr<USceneComponent>, FDelegateHandle>> SpatiallyTrackedRoots;
+};
+
+/* Content preloaded for a single world, or for the whole game instance if requested without a world */
+struct FFlowPreloadRequests
+{
+	/* Handles keep loaded assets in memory until they're released */
+	TArray<TSharedPtr<FStreamableHandle>> Handles;
+
+	/* Every path requested so far, so shared sub-graphs and content are requested once */
+	TSet<FSoftObjectPath> Paths;
+
+	int32 PendingRequests = 0;
+};
+
 /**
  * Flow Subsystem
  * - manages lifetime of Flow Graphs
@@ -77,6 +133,14 @@ public:
 
 	virtual UFlowAsset* CreateRootFlow(UObject* Owner, UFlowAsset* FlowAsset, const bool bAllowMultipleInstances = true, const FString& NewInstanceName = FString());
 
+	/* Start the same root Flow for many owners in one call, i.e. for actors streamed in together
+	 * Template is prepared once, and owners already running this template are found in a single pass */
+	UFUNCTION(BlueprintCallable, Category = "FlowSubsystem")
+	virtual void StartRootFlows(const TArray<UObject*>& Owners, UFlowAsset* FlowAsset, const bool bAllowMultipleInstances = true);
+
+	/* Batched version of CreateRootFlow, OutNewFlows receives only successfully created instances */
+	virtual void CreateRootFlows(TConstArrayView<UObject*> Owners, UFlowAsset* FlowAsset, const bool bAllowMultipleInstances, TArray<UFlowAsset*>& OutNewFlows);
+
 	/* Finish Policy value is read by Flow Node
 	 * Nodes have opportunity to terminate themselves differently if Flow Graph has been aborted
 	 * Example: Spawn node might despawn all actors if Flow Graph is aborted, not completed */
@@ -96,6 +160,11 @@ protected:
 public:
 	UFlowAsset* CreateFlowInstance(const TWeakObjectPtr<UObject> Owner, UFlowAsset* LoadedFlowAsset, FString NewInstanceName = FString());
 
+protected:
+	// Work shared by all instances of the template, done once per batch
+	void PrepareTemplateForInstancing(UFlowAsset* LoadedFlowAsset);
+	UFlowAsset* InstantiatePreparedTemplate(const TWeakObjectPtr<UObject> Owner, UFlowAsset* LoadedFlowAsset, const FString& BaseInstanceName, FString NewInstanceName);
+
 protected:
 	virtual void AddInstancedTemplate(UFlowAsset* Template);
 	virtual void RemoveInstancedTemplate(UFlowAsset* Template);
@@ -139,6 +208,63 @@ public:
 	UFUNCTION(BlueprintPure, Category = "FlowSubsystem")
 	UFlowSaveGame* GetLoadedSaveGame() const { return LoadedSaveGame; }
 
+//////////////////////////////////////////////////////////////////////////
+// Preloading
+
+	/* Asynchronously loads templates listed in the manifest, i.e. during a loading screen
+	 * Flow Assets and content softly referenced by their nodes are followed recursively, according to manifest flags
+	 * Content preloaded for a world is released on the world cleanup
+	 * Content preloaded without a world, i.e. UFlowSettings::DefaultPreloadManifest, is kept until subsystem is deinitialized */
+	UFUNCTION(BlueprintCallable, Category = "FlowSubsystem", meta = (WorldContext = "WorldContextObject"))
+	virtual void PreloadManifest(const UFlowPreloadManifest* Manifest, const UObject* WorldContextObject = nullptr);
+
+	/* Releases content preloaded for the world of given object, or content preloaded without a world if there's no object */
+	UFUNCTION(BlueprintCallable, Category = "FlowSubsystem", meta = (WorldContext = "WorldContextObject"))
+	virtual void ReleasePreloadedContent(const UObject* WorldContextObject = nullptr);
+
+	UFUNCTION(BlueprintPure, Category = "FlowSubsystem")
+	bool IsPreloading() const;
+
+	/* Called after all assets requested by PreloadManifest have been loaded */
+	UPROPERTY(BlueprintAssignable, Category = "FlowSubsystem")
+	FSimpleFlowEvent OnPreloadCompleted;
+
+#if WITH_EDITOR
+	/* Templates instanced since the editor started, source of UFlowPreloadManifest::GatherFromRecordedUsage */
+	static const TSet<FSoftObjectPath>& GetRecordedTemplateUsage() { return RecordedTemplateUsage; }
+#endif
+
+private:
+	bool RequestPreload(const TObjectKey<UWorld> World, TArray<FSoftObjectPath> Paths, const bool bPreloadSubGraphs, const bool bPreloadNodeContent);
+	void OnPreloadBatchLoaded(TArray<FSoftObjectPath> Paths, const TObjectKey<UWorld> World, const bool bPreloadSubGraphs, const bool bPreloadNodeContent);
+	void ReleasePreloadRequests(const TObjectKey<UWorld> World);
+
+	// Soft references of nodes and add-ons of given template
+	static void GatherNodeReferences(const UFlowAsset* FlowAsset, const bool bPreloadSubGraphs, const bool bPreloadNodeContent, TArray<FSoftObjectPath>& OutPaths);
+
+	FStreamableManager PreloadStreamableManager;
+
+	/* Requests of every world, content preloaded without a world is kept under a null world */
+	TMap<TObjectKey<UWorld>, FFlowPreloadRequests> PreloadRequests;
+
+#if WITH_EDITOR
+	static TSet<FSoftObjectPath> RecordedTemplateUsage;
+#endif
+
+#if !UE_BUILD_SHIPPING
+//////////////////////////////////////////////////////////////////////////
+// Memory footprint
+
+public:
+	/* Memory allocated by every instanced template and each of its instances, largest templates first
+	 * Save buffers are records of the loaded save game, matched with instances by name */
+	void GatherMemoryFootprint(TArray<FFlowTemplateMemoryReport>& OutReports) const;
+
+	/* Logs footprint of every template, the largest instances and totals
+	 * Available as console command: Flow.DumpMemoryFootprint [NumTopOffenders] */
+	void DumpMemoryFootprint(FOutputDevice& Ar, const int32 NumTopOffenders = 10) const;
+#endif
+
 //////////////////////////////////////////////////////////////////////////
 // Component Registry
 
@@ -146,6 +272,48 @@ protected:
 	/* All the Flow Components currently existing in the world */
 	TMultiMap<FGameplayTag, TWeakObjectPtr<UFlowComponent>> FlowComponentRegistry;
 
+private:
+	/* Registry and instance data of every world, so queries and saves can be scoped to a single world
+	 * Root instances not bound to any world are kept in the partition of a null world */
+	TMap<TObjectKey<UWorld>, FFlowWorldPartition> WorldPartitions;
+
+	FFlowWorldPartition* FindWorldPartition(const UWorld* World);
+	const FFlowWorldPartition* FindWorldPartition(const UWorld* World) const;
+
+	/* Returns null for the world being removed, so callbacks triggered by the removal don't create its partition again */
+	FFlowWorldPartition* FindOrAddWorldPartition(const UWorld* World);
+
+	/* World of the partition being removed by RemoveWorldPartition */
+	TObjectKey<UWorld> RemovedWorld;
+
+	/* Removes given components from FlowComponentRegistry, visiting only entries of given tags */
+	void RemoveFromComponentRegistry(const TArray<FGameplayTag>& Tags, const TSet<TWeakObjectPtr<UFlowComponent>>& Components);
+
+	void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+	void OnPreLevelRemovedFromWorld(ULevel* Level, UWorld* World);
+
+	void AddToRegistry(const FGameplayTag& Tag, UFlowComponent* Component);
+	void RemoveFromRegistry(const FGameplayTag& Tag, UFlowComponent* Component);
+
+	void AddRootInstance(UFlowAsset* Instance, UObject* Owner);
+	void RemoveRootInstance(UFlowAsset* Instance);
+
+	void AddToSpatialGrid(UFlowComponent* Component);
+	void RemoveFromSpatialGrid(UFlowComponent* Component);
+	void OnComponentOwnerMoved(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport, TWeakObjectPtr<UFlowComponent> Component);
+
+public:
+	/* Drops registrations of given world in one step, and finishes root flows still owned by objects of this world
+	 * Called automatically on world cleanup, components are expected to unregister themselves on End Play before that */
+	virtual void RemoveWorldPartition(const UWorld* World);
+
+	/* Unregisters all Flow Components of given level in one pass, and finishes root flows owned by objects of this level
+	 * Components are then skipped when unregistering themselves on End Play, and their Identity Tag changes are ignored
+	 * Called before streaming level is removed from the world, if UFlowSettings::bBulkUnregisterOnLevelRemoval is set */
+	virtual void UnregisterLevelComponents(ULevel* Level);
+
+	bool IsComponentRegistered(UFlowComponent* Component) const;
+
 protected:
 	virtual void RegisterComponent(UFlowComponent* Component);
 	virtual void OnIdentityTagAdded(UFlowComponent* Component, const FGameplayTag& AddedTag);
@@ -174,15 +342,33 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "FlowSubsystem")
 	FTaggedFlowComponentEvent OnComponentTagRemoved;
 
+	/* Called once after unregistering all Flow Components of the level being removed from the world
+	 * OnComponentUnregistered isn't called for these components, observers need to handle both events */
+	UPROPERTY(BlueprintAssignable, Category = "FlowSubsystem")
+	FLevelFlowComponentsEvent OnLevelComponentsUnregistered;
+
+	/**
+	 * Sends Notify Tags to all Flow Components identified by paired Actor Tags, i.e. a single event fanned out to many actors
+	 * Every Actor Tag is resolved once, and every component receives all its Notify Tags as a single replicated update
+	 * Components receive it like a notify from the graph, ReceiveNotify is broadcasted without a sender component
+	 * 
+	 * @param Notifies Pairs of Actor Tag identifying recipients and Notify Tag delivered to them
+	 * @param NetMode Checked against every recipient component
+	 * @param WorldContextObject If set, only components registered in the world of this object are notified
+	 */
+	UFUNCTION(BlueprintCallable, Category = "FlowSubsystem", meta = (WorldContext = "WorldContextObject"))
+	virtual void BulkNotifyActors(const TArray<FNotifyTagReplication>& Notifies, const EFlowNetMode NetMode = EFlowNetMode::Authority, const UObject* WorldContextObject = nullptr);
+
 	/**
 	 * Returns all registered Flow Components identified by given tag
 	 * 
 	 * @param Tag Tag to check if it matches Identity Tags of registered Flow Components
 	 * @param ComponentClass Only components matching this class we'll be returned
 	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param WorldContextObject If set, only components registered in the world of this object are returned
 	 */
-	UFUNCTION(BlueprintPure, Category = "FlowSubsystem", meta = (DeterminesOutputType = "ComponentClass"))
-	TSet<UFlowComponent*> GetFlowComponentsByTag(const FGameplayTag Tag, const TSubclassOf<UFlowComponent> ComponentClass, const bool bExactMatch = true) const;
+	UFUNCTION(BlueprintPure, Category = "FlowSubsystem", meta = (WorldContext = "WorldContextObject", DeterminesOutputType = "ComponentClass"))
+	TSet<UFlowComponent*> GetFlowComponentsByTag(const FGameplayTag Tag, const TSubclassOf<UFlowComponent> ComponentClass, const bool bExactMatch = true, const UObject* WorldContextObject = nullptr) const;
 
 	/**
 	 * Returns all registered Flow Components identified by Any or All provided tags
@@ -191,9 +377,10 @@ public:
 	 * @param MatchType If Any, returned component needs to have only one of given tags. If All, component needs to have all given Identity Tags
 	 * @param ComponentClass Only components matching this class we'll be returned
 	* @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param WorldContextObject If set, only components registered in the world of this object are returned
 	 */
-	UFUNCTION(BlueprintPure, Category = "FlowSubsystem", meta = (DeterminesOutputType = "ComponentClass"))
-	TSet<UFlowComponent*> GetFlowComponentsByTags(const FGameplayTagContainer Tags, const EGameplayContainerMatchType MatchType, const TSubclassOf<UFlowComponent> ComponentClass, const bool bExactMatch = true) const;
+	UFUNCTION(BlueprintPure, Category = "FlowSubsystem", meta = (WorldContext = "WorldContextObject", DeterminesOutputType = "ComponentClass"))
+	TSet<UFlowComponent*> GetFlowComponentsByTags(const FGameplayTagContainer Tags, const EGameplayContainerMatchType MatchType, const TSubclassOf<UFlowComponent> ComponentClass, const bool bExactMatch = true, const UObject* WorldContextObject = nullptr) const;
 
 	/**
 	 * Returns all registered actors with Flow Component identified by given tag
@@ -201,9 +388,10 @@ public:
 	 * @param Tag Tag to check if it matches Identity Tags of registered Flow Components
 	 * @param ActorClass Only actors matching this class we'll be returned
 	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param WorldContextObject If set, only components registered in the world of this object are returned
 	 */
-	UFUNCTION(BlueprintPure, Category = "FlowSubsystem", meta = (DeterminesOutputType = "ActorClass"))
-	TSet<AActor*> GetFlowActorsByTag(const FGameplayTag Tag, const TSubclassOf<AActor> ActorClass, const bool bExactMatch = true) const;
+	UFUNCTION(BlueprintPure, Category = "FlowSubsystem", meta = (WorldContext = "WorldContextObject", DeterminesOutputType = "ActorClass"))
+	TSet<AActor*> GetFlowActorsByTag(const FGameplayTag Tag, const TSubclassOf<AActor> ActorClass, const bool bExactMatch = true, const UObject* WorldContextObject = nullptr) const;
 
 	/**
 	 * Returns all registered actors with Flow Component identified by Any or All provided tags
@@ -212,9 +400,10 @@ public:
 	 * @param MatchType If Any, returned component needs to have only one of given tags. If All, component needs to have all given Identity Tags
 	 * @param ActorClass Only actors matching this class we'll be returned
 	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param WorldContextObject If set, only components registered in the world of this object are returned
 	 */
-	UFUNCTION(BlueprintPure, Category = "FlowSubsystem", meta = (DeterminesOutputType = "ActorClass"))
-	TSet<AActor*> GetFlowActorsByTags(const FGameplayTagContainer Tags, const EGameplayContainerMatchType MatchType, const TSubclassOf<AActor> ActorClass, const bool bExactMatch = true) const;
+	UFUNCTION(BlueprintPure, Category = "FlowSubsystem", meta = (WorldContext = "WorldContextObject", DeterminesOutputType = "ActorClass"))
+	TSet<AActor*> GetFlowActorsByTags(const FGameplayTagContainer Tags, const EGameplayContainerMatchType MatchType, const TSubclassOf<AActor> ActorClass, const bool bExactMatch = true, const UObject* WorldContextObject = nullptr) const;
 
 	/**
 	 * Returns all registered actors as pairs: Actor as key, its Flow Component as value
@@ -222,9 +411,10 @@ public:
 	 * @param Tag Tag to check if it matches Identity Tags of registered Flow Components
 	 * @param ActorClass Only actors matching this class we'll be returned
 	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param WorldContextObject If set, only components registered in the world of this object are returned
 	 */
-	UFUNCTION(BlueprintPure, Category = "FlowSubsystem", meta = (DeterminesOutputType = "ActorClass"))
-	TMap<AActor*, UFlowComponent*> GetFlowActorsAndComponentsByTag(const FGameplayTag Tag, const TSubclassOf<AActor> ActorClass, const bool bExactMatch = true) const;
+	UFUNCTION(BlueprintPure, Category = "FlowSubsystem", meta = (WorldContext = "WorldContextObject", DeterminesOutputType = "ActorClass"))
+	TMap<AActor*, UFlowComponent*> GetFlowActorsAndComponentsByTag(const FGameplayTag Tag, const TSubclassOf<AActor> ActorClass, const bool bExactMatch = true, const UObject* WorldContextObject = nullptr) const;
 
 	/**
 	 * Returns all registered actors as pairs: Actor as key, its Flow Component as value
@@ -233,9 +423,51 @@ public:
 	 * @param MatchType If Any, returned component needs to have only one of given tags. If All, component needs to have all given Identity Tags
 	 * @param ActorClass Only actors matching this class we'll be returned
 	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param WorldContextObject If set, only components registered in the world of this object are returned
+	 */
+	UFUNCTION(BlueprintPure, Category = "FlowSubsystem", meta = (WorldContext = "WorldContextObject", DeterminesOutputType = "ActorClass"))
+	TMap<AActor*, UFlowComponent*> GetFlowActorsAndComponentsByTags(const FGameplayTagContainer Tags, const EGameplayContainerMatchType MatchType, const TSubclassOf<AActor> ActorClass, const bool bExactMatch = true, const UObject* WorldContextObject = nullptr) const;
+
+	/**
+	 * Returns registered Flow Components identified by given tag, with owner located within the radius
+	 * Uses the spatial grid if UFlowSettings::bEnableSpatialComponentQueries is set, otherwise checks every component identified by the tag
+	 * 
+	 * @param WorldContextObject Only components registered in the world of this object are considered
+	 * @param Tag Tag to check if it matches Identity Tags of registered Flow Components
+	 * @param Center Location of the query
+	 * @param Radius Max distance between Center and the owner location
+	 * @param ComponentClass Only components matching this class we'll be returned
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching
+	 */
+	UFUNCTION(BlueprintPure, Category = "FlowSubsystem", meta = (WorldContext = "WorldContextObject", DeterminesOutputType = "ComponentClass"))
+	TSet<UFlowComponent*> GetFlowComponentsByTagInRadius(const UObject* WorldContextObject, const FGameplayTag Tag, const FVector Center, const float Radius, const TSubclassOf<UFlowComponent> ComponentClass, const bool bExactMatch = true) const;
+
+	/**
+	 * Returns registered Flow Components identified by given tag, with owner located inside the bounds
+	 * Uses the spatial grid if UFlowSettings::bEnableSpatialComponentQueries is set, otherwise checks every component identified by the tag
+	 * 
+	 * @param WorldContextObject Only components registered in the world of this object are considered
+	 * @param Tag Tag to check if it matches Identity Tags of registered Flow Components
+	 * @param Bounds World-space box containing owner locations
+	 * @param ComponentClass Only components matching this class we'll be returned
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching
 	 */
-	UFUNCTION(BlueprintPure, Category = "FlowSubsystem", meta = (DeterminesOutputType = "ActorClass"))
-	TMap<AActor*, UFlowComponent*> GetFlowActorsAndComponentsByTags(const FGameplayTagContainer Tags, const EGameplayContainerMatchType MatchType, const TSubclassOf<AActor> ActorClass, const bool bExactMatch = true) const;
+	UFUNCTION(BlueprintPure, Category = "FlowSubsystem", meta = (WorldContext = "WorldContextObject", DeterminesOutputType = "ComponentClass"))
+	TSet<UFlowComponent*> GetFlowComponentsByTagInBox(const UObject* WorldContextObject, const FGameplayTag Tag, const FBox Bounds, const TSubclassOf<UFlowComponent> ComponentClass, const bool bExactMatch = true) const;
+
+	/**
+	 * Returns registered Flow Component identified by given tag, with owner located nearest to the location
+	 * Uses the spatial grid if UFlowSettings::bEnableSpatialComponentQueries is set, otherwise checks every component identified by the tag
+	 * 
+	 * @param WorldContextObject Only components registered in the world of this object are considered
+	 * @param Tag Tag to check if it matches Identity Tags of registered Flow Components
+	 * @param Location Location of the query
+	 * @param MaxDistance Components further away are ignored, unlimited if 0
+	 * @param ComponentClass Only components matching this class we'll be returned
+	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching
+	 */
+	UFUNCTION(BlueprintPure, Category = "FlowSubsystem", meta = (WorldContext = "WorldContextObject", DeterminesOutputType = "ComponentClass"))
+	UFlowComponent* GetNearestFlowComponentByTag(const UObject* WorldContextObject, const FGameplayTag Tag, const FVector Location, const float MaxDistance, const TSubclassOf<UFlowComponent> ComponentClass, const bool bExactMatch = true) const;
 
 	/**
 	 * Returns all registered Flow Components identified by given tag
@@ -243,14 +475,15 @@ public:
 	 * @tparam T Only components matching this class we'll be returned
 	 * @param Tag Tag to check if it matches Identity Tags of registered Flow Components
 	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param World If set, only components registered in this world are returned
 	 */
 	template <class T>
-	TSet<TWeakObjectPtr<T>> GetComponents(const FGameplayTag& Tag, const bool bExactMatch = true) const
+	TSet<TWeakObjectPtr<T>> GetComponents(const FGameplayTag& Tag, const bool bExactMatch = true, const UWorld* World = nullptr) const
 	{
 		static_assert(TPointerIsConvertibleFromTo<T, const UActorComponent>::Value, "'T' template parameter to GetComponents must be derived from UActorComponent");
 
 		TArray<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-		FindComponents(Tag, bExactMatch, FoundComponents);
+		FindComponents(World, Tag, bExactMatch, T::StaticClass(), nullptr, FoundComponents);
 
 		TSet<TWeakObjectPtr<T>> Result;
 		for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
@@ -274,14 +507,15 @@ public:
 	 * @param Tags Container to check if it matches Identity Tags of registered Flow Components
 	 * @param MatchType If Any, returned component needs to have only one of given tags. If All, component needs to have all given Identity Tags
 	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param World If set, only components registered in this world are returned
 	 */
 	template <class T>
-	TSet<TWeakObjectPtr<T>> GetComponents(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch = true) const
+	TSet<TWeakObjectPtr<T>> GetComponents(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch = true, const UWorld* World = nullptr) const
 	{
 		static_assert(TPointerIsConvertibleFromTo<T, const UActorComponent>::Value, "'T' template parameter to GetComponents must be derived from UActorComponent");
 
 		TSet<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-		FindComponents(Tags, MatchType, bExactMatch, FoundComponents);
+		FindComponents(World, Tags, MatchType, bExactMatch, T::StaticClass(), nullptr, FoundComponents);
 
 		TSet<TWeakObjectPtr<T>> Result;
 		for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
@@ -304,14 +538,15 @@ public:
 	 * @tparam T Only components matching this class we'll be returned
 	 * @param Tag Tag to check if it matches Identity Tags of registered Flow Components
 	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param World If set, only components registered in this world are returned
 	 */
 	template <class T>
-	TSet<TWeakObjectPtr<T>> GetActors(const FGameplayTag& Tag, const bool bExactMatch = true) const
+	TSet<TWeakObjectPtr<T>> GetActors(const FGameplayTag& Tag, const bool bExactMatch = true, const UWorld* World = nullptr) const
 	{
 		static_assert(TPointerIsConvertibleFromTo<T, const AActor>::Value, "'T' template parameter to GetActors must be derived from AActor");
 
 		TArray<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-		FindComponents(Tag, bExactMatch, FoundComponents);
+		FindComponents(World, Tag, bExactMatch, nullptr, T::StaticClass(), FoundComponents);
 
 		TSet<TWeakObjectPtr<T>> Result;
 		for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
@@ -335,14 +570,15 @@ public:
 	 * @param Tags Container to check if it matches Identity Tags of registered Flow Components
 	 * @param MatchType If Any, returned component needs to have only one of given tags. If All, component needs to have all given Identity Tags
 	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param World If set, only components registered in this world are returned
 	 */
 	template <class T>
-	TSet<TWeakObjectPtr<T>> GetActors(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch = true) const
+	TSet<TWeakObjectPtr<T>> GetActors(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch = true, const UWorld* World = nullptr) const
 	{
 		static_assert(TPointerIsConvertibleFromTo<T, const AActor>::Value, "'T' template parameter to GetActors must be derived from AActor");
 
 		TSet<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-		FindComponents(Tags, MatchType, bExactMatch, FoundComponents);
+		FindComponents(World, Tags, MatchType, bExactMatch, nullptr, T::StaticClass(), FoundComponents);
 
 		TSet<TWeakObjectPtr<T>> Result;
 		for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
@@ -366,15 +602,16 @@ public:
 	 * @tparam ComponentT Only components matching this class we'll be returned
 	 * @param Tag Tag to check if it matches Identity Tags of registered Flow Components
 	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param World If set, only components registered in this world are returned
 	 */
 	template <class ActorT, class ComponentT>
-	TMap<TWeakObjectPtr<ActorT>, TWeakObjectPtr<ComponentT>> GetActorsAndComponents(const FGameplayTag& Tag, const bool bExactMatch = true) const
+	TMap<TWeakObjectPtr<ActorT>, TWeakObjectPtr<ComponentT>> GetActorsAndComponents(const FGameplayTag& Tag, const bool bExactMatch = true, const UWorld* World = nullptr) const
 	{
 		static_assert(TPointerIsConvertibleFromTo<ActorT, const AActor>::Value, "'ActorT' template parameter to GetActorsAndComponents must be derived from AActor");
 		static_assert(TPointerIsConvertibleFromTo<ComponentT, const UActorComponent>::Value, "'ComponentT' template parameter to GetActorsAndComponents must be derived from UActorComponent");
 
 		TArray<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-		FindComponents(Tag, bExactMatch, FoundComponents);
+		FindComponents(World, Tag, bExactMatch, ComponentT::StaticClass(), ActorT::StaticClass(), FoundComponents);
 
 		TMap<TWeakObjectPtr<ActorT>, TWeakObjectPtr<ComponentT>> Result;
 		for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
@@ -401,15 +638,16 @@ public:
 	 * @param Tags Container to check if it matches Identity Tags of registered Flow Components
 	 * @param MatchType If Any, returned component needs to have only one of given tags. If All, component needs to have all given Identity Tags
 	 * @param bExactMatch If true, the tag has to be exactly present, if false then TagContainer will include it's parent tags while matching. Be careful, using latter option may be very expensive, as the search cost is proportional to the number of registered Gameplay Tags!
+	 * @param World If set, only components registered in this world are returned
 	 */
 	template <class ActorT, class ComponentT>
-	TMap<TWeakObjectPtr<ActorT>, TWeakObjectPtr<ComponentT>> GetActorsAndComponents(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch = true) const
+	TMap<TWeakObjectPtr<ActorT>, TWeakObjectPtr<ComponentT>> GetActorsAndComponents(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch = true, const UWorld* World = nullptr) const
 	{
 		static_assert(TPointerIsConvertibleFromTo<ActorT, const AActor>::Value, "'ActorT' template parameter to GetActorsAndComponents must be derived from AActor");
 		static_assert(TPointerIsConvertibleFromTo<ComponentT, const UActorComponent>::Value, "'ComponentT' template parameter to GetActorsAndComponents must be derived from UActorComponent");
 
 		TSet<TWeakObjectPtr<UFlowComponent>> FoundComponents;
-		FindComponents(Tags, MatchType, bExactMatch, FoundComponents);
+		FindComponents(World, Tags, MatchType, bExactMatch, ComponentT::StaticClass(), ActorT::StaticClass(), FoundComponents);
 
 		TMap<TWeakObjectPtr<ActorT>, TWeakObjectPtr<ComponentT>> Result;
 		for (const TWeakObjectPtr<UFlowComponent>& Component : FoundComponents)
@@ -431,4 +669,10 @@ public:
 private:
 	void FindComponents(const FGameplayTag& Tag, const bool bExactMatch, TArray<TWeakObjectPtr<UFlowComponent>>& OutComponents) const;
 	void FindComponents(const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch, TSet<TWeakObjectPtr<UFlowComponent>>& OutComponents) const;
+
+	// Class-filtered queries, nullptr class accepts any class and nullptr world searches every world
+	void FindComponents(const UWorld* World, const FGameplayTag& Tag, const bool bExactMatch, const UClass* ComponentClass, const UClass* ActorClass, TArray<TWeakObjectPtr<UFlowComponent>>& OutComponents) const;
+	void FindComponents(const UWorld* World, const FGameplayTagContainer& Tags, const EGameplayContainerMatchType MatchType, const bool bExactMatch, const UClass* ComponentClass, const UClass* ActorClass, TSet<TWeakObjectPtr<UFlowComponent>>& OutComponents) const;
+
+	static bool GetOwnerLocation(const UFlowComponent& Component, FVector& OutLocation);
 };
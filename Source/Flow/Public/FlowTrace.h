@@ -0,0 +1,77 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "Trace/Config.h"
+
+#if !defined(FLOW_TRACE_ENABLED)
+#define FLOW_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+#endif
+
+#if FLOW_TRACE_ENABLED
+
+#include "HAL/PlatformTime.h"
+#include "Trace/Trace.h"
+
+class UFlowAsset;
+class UFlowNode;
+class UFlowNodeBase;
+enum class EFlowDataPinResolveResult : uint8;
+
+// Enable by launching with -trace=flow or calling "Trace.Enable Flow" in the console
+UE_TRACE_CHANNEL_EXTERN(FlowChannel, FLOW_API);
+
+/**
+ * Emits Flow execution events to Unreal Insights.
+ * Every event carries InstanceId, the InstanceCreated event maps it to the template asset and instance name,
+ * so events can be grouped per asset and instance in the trace session.
+ * FlowInsights module reads these events and shows a timing track per instance in the Timing view.
+ */
+struct FLOW_API FFlowTrace
+{
+	static void OutputInstanceCreated(const UFlowAsset& Instance);
+	static void OutputInstanceDestroyed(const UFlowAsset& Instance);
+
+	static void OutputNodeActivated(const UFlowNode& Node);
+	static void OutputNodeFinished(const UFlowNode& Node);
+	static void OutputPinTriggered(const UFlowNode& Node, const FName& PinName, const bool bInput);
+
+	static void OutputDataPinResolved(const UFlowNodeBase& Node, const FName& PinName, const uint64 StartCycle, const EFlowDataPinResolveResult Result);
+};
+
+#define TRACE_FLOW_IS_ENABLED() UE_TRACE_CHANNELEXPR_IS_ENABLED(FlowChannel)
+
+#define TRACE_FLOW_INSTANCE_CREATED(Instance) \
+	do { if (TRACE_FLOW_IS_ENABLED()) { FFlowTrace::OutputInstanceCreated(Instance); } } while (0)
+
+#define TRACE_FLOW_INSTANCE_DESTROYED(Instance) \
+	do { if (TRACE_FLOW_IS_ENABLED()) { FFlowTrace::OutputInstanceDestroyed(Instance); } } while (0)
+
+#define TRACE_FLOW_NODE_ACTIVATED(Node) \
+	do { if (TRACE_FLOW_IS_ENABLED()) { FFlowTrace::OutputNodeActivated(Node); } } while (0)
+
+#define TRACE_FLOW_NODE_FINISHED(Node) \
+	do { if (TRACE_FLOW_IS_ENABLED()) { FFlowTrace::OutputNodeFinished(Node); } } while (0)
+
+#define TRACE_FLOW_PIN_TRIGGERED(Node, PinName, bInput) \
+	do { if (TRACE_FLOW_IS_ENABLED()) { FFlowTrace::OutputPinTriggered(Node, PinName, bInput); } } while (0)
+
+// Returns 0 if the channel is disabled, so the matching TRACE_FLOW_DATA_PIN_RESOLVED knows there's nothing to emit
+#define TRACE_FLOW_DATA_PIN_RESOLVE_BEGIN() \
+	(TRACE_FLOW_IS_ENABLED() ? FPlatformTime::Cycles64() : 0)
+
+#define TRACE_FLOW_DATA_PIN_RESOLVED(Node, PinName, StartCycle, Result) \
+	do { if ((StartCycle) != 0 && TRACE_FLOW_IS_ENABLED()) { FFlowTrace::OutputDataPinResolved(Node, PinName, StartCycle, Result); } } while (0)
+
+#else
+
+#define TRACE_FLOW_IS_ENABLED() false
+#define TRACE_FLOW_INSTANCE_CREATED(Instance) do {} while (0)
+#define TRACE_FLOW_INSTANCE_DESTROYED(Instance) do {} while (0)
+#define TRACE_FLOW_NODE_ACTIVATED(Node) do {} while (0)
+#define TRACE_FLOW_NODE_FINISHED(Node) do {} while (0)
+#define TRACE_FLOW_PIN_TRIGGERED(Node, PinName, bInput) do {} while (0)
+#define TRACE_FLOW_DATA_PIN_RESOLVE_BEGIN() 0
+#define TRACE_FLOW_DATA_PIN_RESOLVED(Node, PinName, StartCycle, Result) do {} while (0)
+
+#endif
@@ -6,6 +6,7 @@
 #include "FlowWorldSettings.generated.h"
 
 class UFlowComponent;
+class UFlowPreloadManifest;
 
 /**
  * World Settings used to start a Flow for this world
@@ -20,5 +21,11 @@ private:
 	TObjectPtr<UFlowComponent> FlowComponent;
 
 public:
+	// Templates used by this map, loaded asynchronously before actors begin play and released on the world cleanup
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Flow")
+	TSoftObjectPtr<UFlowPreloadManifest> PreloadManifest;
+
 	UFlowComponent* GetFlowComponent() const { return FlowComponent; }
+
+	virtual void PreInitializeComponents() override;
 };
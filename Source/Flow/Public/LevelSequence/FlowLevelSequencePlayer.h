@@ -32,6 +32,12 @@ public:
 		const bool bAlwaysRelevant,
 		ALevelSequenceActor*& OutActor);
 
+	// Sequence Actor might be placed exactly where playback happens
+	static FTransform GetSequenceActorTransform(const AActor* TransformOriginActor);
+
+	// Returns true if Transform Origin set on the actor has changed
+	static bool ApplyTransformOrigin(ALevelSequenceActor& Actor, AActor* TransformOriginActor);
+
 	void SetFlowEventReceiver(UFlowNode* FlowNode) { FlowEventReceiver = FlowNode; }
 
 	// IMovieScenePlayer
@@ -0,0 +1,75 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "LevelSequencePlayer.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "FlowLevelSequencePool.generated.h"
+
+class AFlowLevelSequenceActor;
+class ALevelSequenceActor;
+class ULevelSequence;
+class UFlowLevelSequencePlayer;
+
+// Pooled actors can be reused only for the same sequence and network settings
+struct FFlowLevelSequencePoolKey
+{
+	TObjectKey<ULevelSequence> Sequence;
+	bool bReplicates = false;
+	bool bAlwaysRelevant = false;
+
+	FFlowLevelSequencePoolKey() {}
+
+	FFlowLevelSequencePoolKey(const ULevelSequence* InSequence, const bool bInReplicates, const bool bInAlwaysRelevant)
+		: Sequence(InSequence)
+		, bReplicates(bInReplicates)
+		, bAlwaysRelevant(bInReplicates && bInAlwaysRelevant)
+	{
+	}
+
+	bool operator==(const FFlowLevelSequencePoolKey& Other) const
+	{
+		return Sequence == Other.Sequence && bReplicates == Other.bReplicates && bAlwaysRelevant == Other.bAlwaysRelevant;
+	}
+
+	friend uint32 GetTypeHash(const FFlowLevelSequencePoolKey& Key)
+	{
+		return HashCombine(GetTypeHash(Key.Sequence), (Key.bReplicates ? 1 : 0) | (Key.bAlwaysRelevant ? 2 : 0));
+	}
+};
+
+/**
+ * Per-world pool of Level Sequence Actors (and players created by them) used by Play Level Sequence nodes
+ * Avoids spawning and destroying actors every time a sequence is played, i.e. ambient cinematics or barks
+ * Pool size is set in Flow Settings, setting it to 0 disables pooling
+ */
+UCLASS()
+class FLOW_API UFlowLevelSequencePool : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+	// Borrows pooled player for the given sequence, creates a new one if none available
+	UFlowLevelSequencePlayer* AcquirePlayer(
+		ULevelSequence* LevelSequence,
+		const FMovieSceneSequencePlaybackSettings& Settings,
+		const FLevelSequenceCameraSettings& CameraSettings,
+		AActor* TransformOriginActor,
+		const bool bReplicates,
+		const bool bAlwaysRelevant,
+		ALevelSequenceActor*& OutActor);
+
+	// Returns player to the pool, player is stopped and detached from the Flow Node
+	// Actor is destroyed if the pool for this sequence is already full
+	void ReleasePlayer(ALevelSequenceActor* SequenceActor);
+
+	int32 GetNumPooledActors() const;
+
+private:
+	// Actors are owned by the world, pool only keeps weak references
+	TMap<FFlowLevelSequencePoolKey, TArray<TWeakObjectPtr<AFlowLevelSequenceActor>>> PooledActors;
+};
@@ -45,11 +45,13 @@ struct FMovieSceneFlowTriggerTemplate : public FMovieSceneFlowTemplateBase
 	FMovieSceneFlowTriggerTemplate() {}
 	FMovieSceneFlowTriggerTemplate(const UMovieSceneFlowTriggerSection& Section, const UMovieSceneFlowTrack& Track);
 
+	// Sorted, allows for finding events in the swept range with a binary search
 	UPROPERTY()
 	TArray<FFrameNumber> EventTimes;
 
+	// Event names matching EventTimes, empty event names are skipped while building the template
 	UPROPERTY()
-	TArray<FString> EventNames;
+	TArray<FName> EventNames;
 
 private:
 	virtual UScriptStruct& GetScriptStructImpl() const override { return *StaticStruct(); }
@@ -65,7 +67,7 @@ struct FMovieSceneFlowRepeaterTemplate : public FMovieSceneFlowTemplateBase
 	FMovieSceneFlowRepeaterTemplate(const UMovieSceneFlowRepeaterSection& Section, const UMovieSceneFlowTrack& Track);
 
 	UPROPERTY()
-	FString EventName;
+	FName EventName;
 
 private:
 	virtual UScriptStruct& GetScriptStructImpl() const override { return *StaticStruct(); }
@@ -8,6 +8,7 @@
 #include "FlowNode_ComponentObserver.generated.h"
 
 class UFlowComponent;
+class ULevel;
 
 /**
  * Base class for nodes operating on actors with the Flow Component
@@ -59,6 +60,10 @@ protected:
 	UFUNCTION()
 	virtual void OnComponentUnregistered(UFlowComponent* Component);
 
+	// Components of the removed level are unregistered in bulk, if UFlowSettings::bBulkUnregisterOnLevelRemoval is enabled
+	UFUNCTION()
+	virtual void OnLevelComponentsUnregistered(ULevel* Level, const TArray<UFlowComponent*>& Components);
+
 	virtual void ObserveActor(TWeakObjectPtr<AActor> Actor, TWeakObjectPtr<UFlowComponent> Component) {}
 	virtual void ForgetActor(TWeakObjectPtr<AActor> Actor, TWeakObjectPtr<UFlowComponent> Component) {}
 
@@ -11,6 +11,8 @@
 #include "FlowNode_ExecuteComponent.generated.h"
 
 // Forward Declarations
+class IFlowCoreExecutableInterface;
+class IFlowExternalExecutableInterface;
 class IFlowOwnerInterface;
 class UFlowInjectComponentsManager;
 
@@ -37,6 +39,26 @@ namespace EExecuteComponentSource_Classifiers
 	FORCEINLINE bool DoesComponentSourceUseInjectManager(EExecuteComponentSource Source) { return FLOW_IS_ENUM_IN_SUBRANGE(Source, EExecuteComponentSource::UsesInjectManager); }
 }
 
+// Interface dispatch for the resolved component, bound once instead of casting on every forwarded call
+// Native pointers are set if the interface is implemented in C++, Blueprint flags if it's implemented only in Blueprint
+struct FFlowExecuteComponentDispatch
+{
+	void Bind(UActorComponent& InComponent);
+	void Reset() { *this = FFlowExecuteComponentDispatch(); }
+
+	bool IsBoundTo(const UActorComponent& InComponent) const { return Component.Get() == &InComponent; }
+
+	TWeakObjectPtr<UActorComponent> Component;
+
+	IFlowCoreExecutableInterface* NativeCoreExecutable = nullptr;
+	IFlowExternalExecutableInterface* NativeExternalExecutable = nullptr;
+
+	bool bBlueprintCoreExecutable = false;
+	bool bBlueprintExternalExecutable = false;
+
+	bool bDataPinValueSupplier = false;
+};
+
 /**
  * Execute a UActorComponent on the owning actor as if it was a flow subgraph
  */
@@ -137,6 +159,9 @@ protected:
 	UPROPERTY(Transient)
 	TObjectPtr<UFlowInjectComponentsManager> InjectComponentsManager = nullptr;
 
+	// Bound whenever the component gets resolved, see TryResolveComponent and GetResolvedComponent
+	mutable FFlowExecuteComponentDispatch ComponentDispatch;
+
 	// Look for the component (by class) on the Actor and re-use it (rather than injecting)
 	// if the component already exists.
 	UPROPERTY(EditAnywhere, Category = Configuration, DisplayName = "Re-use existing component if found", meta = (EditConditionHides, EditCondition = "ComponentSource == EExecuteComponentSource::InjectFromClass"))
@@ -146,6 +171,12 @@ protected:
 	UPROPERTY(EditAnywhere, Category = Configuration, DisplayName = "Allow injecting component", meta = (EditConditionHides, EditCondition = "ComponentSource == EExecuteComponentSource::InjectFromClass && bReuseExistingComponent"))
 	bool bAllowInjectComponent = true;
 
+	// Removed component is deactivated and unregistered, instead of being destroyed, and re-registered on the next injection to the same actor
+	// Only enable if the component resets its state in InitializeInstance/DeinitializeInstance or BeginPlay/EndPlay
+	// Replicated components are never pooled
+	UPROPERTY(EditAnywhere, Category = Configuration, DisplayName = "Pool injected component", meta = (EditConditionHides, EditCondition = "ComponentSource == EExecuteComponentSource::InjectFromTemplate || ComponentSource == EExecuteComponentSource::InjectFromClass"))
+	bool bPoolInjectedComponent = false;
+
 	// Inject component(s) onto the owning Actor
 	UPROPERTY()
 	EExecuteComponentSource ComponentSource = EExecuteComponentSource::Undetermined;
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "EngineDefines.h"
+#include "Engine/EngineTypes.h"
 #include "Engine/StreamableManager.h"
 #include "LevelSequencePlayer.h"
 #include "MovieSceneSequencePlayer.h"
@@ -10,6 +11,7 @@
 #include "Nodes/FlowNode.h"
 #include "FlowNode_PlayLevelSequence.generated.h"
 
+class ALevelSequenceActor;
 class UFlowLevelSequencePlayer;
 
 DECLARE_MULTICAST_DELEGATE(FFlowNodeLevelSequenceEvent);
@@ -20,6 +22,8 @@ DECLARE_MULTICAST_DELEGATE(FFlowNodeLevelSequenceEvent);
  * - Started
  * - Out (always, even if Sequence is invalid)
  * - Completed
+ * If the Sequence wasn't preloaded, it's loaded asynchronously and Start is held until the load completes
+ * - TimedOut, if loading took longer than Load Timeout, node finishes without playing the Sequence
  */
 UCLASS(NotBlueprintable, meta = (DisplayName = "Play Level Sequence"))
 class FLOW_API UFlowNode_PlayLevelSequence : public UFlowNode
@@ -40,6 +44,11 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Sequence")
 	bool bPlayReverse;
 
+	// Max time (in seconds) of waiting for the Sequence to load, if it wasn't preloaded
+	// Zero means waiting until loading completes
+	UPROPERTY(EditAnywhere, Category = "Sequence", meta = (ClampMin = 0.0f))
+	float LoadTimeout;
+
 	UPROPERTY(EditAnywhere, Category = "Sequence")
 	FLevelSequenceCameraSettings CameraSettings;
 	
@@ -69,6 +78,10 @@ protected:
 	UPROPERTY()
 	TObjectPtr<UFlowLevelSequencePlayer> SequencePlayer;
 
+	// Actor owning the Sequence Player, borrowed from UFlowLevelSequencePool
+	UPROPERTY()
+	TObjectPtr<ALevelSequenceActor> SequenceActor;
+
 	// Play Rate set by the user in PlaybackSettings
 	float CachedPlayRate;
 
@@ -83,6 +96,10 @@ protected:
 
 	FStreamableManager StreamableManager;
 
+	// Sequence requested on execution, if it wasn't preloaded
+	TSharedPtr<FStreamableHandle> SequenceLoadHandle;
+	FTimerHandle LoadTimeoutTimerHandle;
+
 public:
 #if WITH_EDITOR
 	// IFlowContextPinSupplierInterface
@@ -97,16 +114,26 @@ public:
 	virtual void FlushContent() override;
 
 	virtual void InitializeInstance() override;
+
+	// Expects the Sequence to be already loaded
 	void CreatePlayer();
 
 protected:
 	virtual void ExecuteInput(const FName& PinName) override;
 
+	void RequestSequenceLoad(const bool bResumePlayback);
+	void OnSequenceLoaded(const bool bResumePlayback);
+	void OnSequenceLoadTimeout();
+	void CancelSequenceLoad();
+
+	virtual void StartPlayback();
+	virtual void ResumePlayback();
+
 	virtual void OnSave_Implementation() override;
 	virtual void OnLoad_Implementation() override;
 
 private:
-	void TriggerEvent(const FString& EventName);
+	void TriggerEvent(const FName& EventName);
 
 public:
 	void OnTimeDilationUpdate(const float NewTimeDilation);
@@ -12,6 +12,7 @@
 #include "Interfaces/FlowDataPinValueSupplierInterface.h"
 #include "Nodes/FlowPin.h"
 #include "Types/FlowDataPinProperties.h"
+#include "Types/FlowMemoryFootprint.h"
 
 #include "FlowNode.generated.h"
 
@@ -327,6 +328,10 @@ public:
 private:
 	TMap<FName, TArray<FPinRecord>> InputRecords;
 	TMap<FName, TArray<FPinRecord>> OutputRecords;
+
+public:
+	// Adds memory allocated by this node and its add-ons, see UFlowSubsystem::GatherMemoryFootprint
+	virtual void GetMemoryFootprint(FFlowMemoryFootprint& OutFootprint) const;
 #endif
 
 public:
@@ -8,6 +8,7 @@
 #include "Interfaces/FlowContextPinSupplierInterface.h"
 #include "FlowMessageLog.h"
 #include "FlowTags.h" // used by subclasses
+#include "FlowTrace.h"
 #include "FlowTypes.h"
 #include "Types/FlowDataPinResults.h"
 
@@ -50,6 +51,21 @@ struct TResolveDataPinWorkingData
 	TArray<FFlowPinValueSupplierData> PinValueSupplierDatas;
 
 	static constexpr bool bCheckDefaultProperties = true;
+
+#if FLOW_TRACE_ENABLED
+	// the working data lives for the whole TryResolveDataPinAs...() call, so it reports the final result with timing
+	~TResolveDataPinWorkingData()
+	{
+		if (TracedNode)
+		{
+			TRACE_FLOW_DATA_PIN_RESOLVED(*TracedNode, TracedPinName, TraceStartCycle, DataPinResult.Result);
+		}
+	}
+
+	const UFlowNodeBase* TracedNode = nullptr;
+	FName TracedPinName;
+	uint64 TraceStartCycle = TRACE_FLOW_DATA_PIN_RESOLVE_BEGIN();
+#endif
 };
 
 /**
@@ -176,6 +192,11 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Instanced, Category = "FlowNode")
 	TArray<TObjectPtr<UFlowNodeAddOn>> AddOns;
 
+	// All AddOns of this instance, including AddOns of AddOns, in depth-first order
+	// Built after AddOns are instanced in InitializeInstance, always empty on templates
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UFlowNodeAddOn>> FlattenedAddOns;
+
 protected:
 	// FlowNodes and AddOns may determine which AddOns are eligible to be their children
 	// - AddOnTemplate - the template of the FlowNodeAddOn that is being considered to be added as a child
@@ -228,6 +249,27 @@ public:
 
 	EFlowForEachAddOnFunctionReturnValue ForEachAddOnForClass(const UClass& InterfaceOrClass, const FFlowNodeAddOnFunction& Function, EFlowForEachAddOnChildRule AddOnChildRule = EFlowForEachAddOnChildRule::AllChildren) const;
 
+	// Inlinable versions of the above, Function is any callable returning EFlowForEachAddOnFunctionReturnValue (not wrapped in TFunction)
+	// Initialized instances iterate FlattenedAddOns instead of recursing into AddOns
+	// Defined in FlowNodeAddOn.h
+	template <typename TFunctionType>
+	EFlowForEachAddOnFunctionReturnValue ForEachAddOnInline(TFunctionType&& Function, EFlowForEachAddOnChildRule AddOnChildRule = EFlowForEachAddOnChildRule::AllChildren) const;
+
+	template <typename TFunctionType>
+	EFlowForEachAddOnFunctionReturnValue ForEachAddOnConstInline(TFunctionType&& Function, EFlowForEachAddOnChildRule AddOnChildRule = EFlowForEachAddOnChildRule::AllChildren) const;
+
+	template <typename TFunctionType>
+	EFlowForEachAddOnFunctionReturnValue ForEachAddOnForClassInline(const UClass& InterfaceOrClass, TFunctionType&& Function, EFlowForEachAddOnChildRule AddOnChildRule = EFlowForEachAddOnChildRule::AllChildren) const;
+
+	template <typename TInterfaceOrClass, typename TFunctionType>
+	EFlowForEachAddOnFunctionReturnValue ForEachAddOnForClassInline(TFunctionType&& Function, EFlowForEachAddOnChildRule AddOnChildRule = EFlowForEachAddOnChildRule::AllChildren) const
+	{
+		return ForEachAddOnForClassInline(*TInterfaceOrClass::StaticClass(), Forward<TFunctionType>(Function), AddOnChildRule);
+	}
+
+protected:
+	void BuildFlattenedAddOns();
+
 public:
 
 //////////////////////////////////////////////////////////////////////////
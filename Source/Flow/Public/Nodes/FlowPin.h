@@ -27,8 +27,11 @@ struct FLOW_API FFlowPin
 	UPROPERTY(EditDefaultsOnly, Category = FlowPin)
 	FText PinFriendlyName;
 
+#if WITH_EDITORONLY_DATA
+	// Shown only in the graph editor, so it's filtered out of cooked packages
 	UPROPERTY(EditDefaultsOnly, Category = FlowPin)
 	FString PinToolTip;
+#endif
 
 protected:
 	// PinType (implies PinCategory)
@@ -128,14 +131,18 @@ public:
 
 	FFlowPin(const FStringView InPinName, const FString& InPinTooltip)
 		: PinName(InPinName)
+#if WITH_EDITORONLY_DATA
 		, PinToolTip(InPinTooltip)
+#endif
 	{
 	}
 
 	FFlowPin(const FStringView InPinName, const FText& InPinFriendlyName, const FString& InPinTooltip)
 		: PinName(InPinName)
 		, PinFriendlyName(InPinFriendlyName)
+#if WITH_EDITORONLY_DATA
 		, PinToolTip(InPinTooltip)
+#endif
 	{
 	}
 
@@ -148,7 +155,9 @@ public:
 	FFlowPin(const FName& InPinName, const FText& InPinFriendlyName, const FString& InPinTooltip)
 		: PinName(InPinName)
 		, PinFriendlyName(InPinFriendlyName)
+#if WITH_EDITORONLY_DATA
 		, PinToolTip(InPinTooltip)
+#endif
 	{
 	}
 
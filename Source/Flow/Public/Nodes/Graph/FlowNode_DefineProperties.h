@@ -38,6 +38,10 @@ public:
 #endif
 
 	bool TryFormatTextWithNamedPropertiesAsParameters(const FText& FormatText, FText& OutFormattedText) const;
+	bool TryFormatTextWithNamedPropertiesAsParameters(const FTextFormat& CompiledFormat, FText& OutFormattedText) const;
+
+	// Resolves current values of all named properties, so callers can compile the format once and reuse it
+	bool TryBuildFormatNamedArguments(FFormatNamedArguments& OutArguments) const;
 
 protected:
 	virtual bool TryFindPropertyByRemappedPinName(
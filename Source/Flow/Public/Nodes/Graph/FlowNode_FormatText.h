@@ -31,6 +31,28 @@ public:
 
 	EFlowDataPinResolveResult TryResolveFormatText(const FName& PinName, FText& OutFormattedText) const;
 
+	// Formats only if any input value changed since the last call, returns the result of formatting
+	EFlowDataPinResolveResult TryUpdateFormatCache(const FName& PinName) const;
+
+private:
+	// Pattern compiled once and the last formatted output, keyed on the input values used to produce it
+	struct FFormatTextCache
+	{
+		FTextFormat CompiledFormat;
+		uint16 TextRevision = 0;
+
+		FFormatNamedArguments Arguments;
+		FText FormattedText;
+		TOptional<FString> FormattedString;
+		TOptional<FName> FormattedName;
+
+		bool bValid = false;
+	};
+
+	mutable FFormatTextCache FormatCache;
+
+	static bool AreArgumentsIdentical(const FFormatNamedArguments& A, const FFormatNamedArguments& B);
+
 public:
 	// IFlowDataPinValueSupplierInterface
 	virtual FFlowDataPinResult_Name TrySupplyDataPinAsName_Implementation(const FName& PinName) const override;
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Nodes/FlowNode.h"
+#include "Types/FlowPredicateProgram.h"
 
 #include "FlowNode_Branch.generated.h"
 
@@ -14,6 +15,11 @@ class UFlowNode_Branch : public UFlowNode
 
 public:
 
+	// IFlowCoreExecutableInterface
+	virtual void InitializeInstance() override;
+	virtual void DeinitializeInstance() override;
+	// --
+
 	// UFlowNodeBase
 	virtual EFlowAddOnAcceptResult AcceptFlowNodeAddOnChild_Implementation(const UFlowNodeAddOn* AddOnTemplate, const TArray<UFlowNodeAddOn*>& AdditionalAddOnsToAssumeAreChildren) const override;
 	// --
@@ -24,4 +30,8 @@ public:
 	static const FName INPIN_Evaluate;
 	static const FName OUTPIN_True;
 	static const FName OUTPIN_False;
+
+protected:
+	// Predicate AddOns flattened on instance initialization, evaluated as AND
+	FFlowPredicateProgram PredicateProgram;
 };
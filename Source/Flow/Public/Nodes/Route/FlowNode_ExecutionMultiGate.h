@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Nodes/FlowNode.h"
+#include "Types/FlowPinBitmask.h"
 #include "FlowNode_ExecutionMultiGate.generated.h"
 
 /**
@@ -28,18 +29,25 @@ private:
 	UPROPERTY(SaveGame)
 	int32 NextOutput;
 
+	// Indexes of already triggered output pins
 	UPROPERTY(SaveGame)
+	FFlowPinBitmask CompletedOutputs;
+
+	// Deprecated, read only from SaveGames written before CompletedOutputs and migrated on load
+	UPROPERTY(SaveGame, meta = (DeprecatedProperty, DeprecationMessage = "Use the CompletedOutputs instead."))
 	TArray<bool> Completed;
 
 public:
 #if WITH_EDITOR
-	virtual bool CanUserAddOutput() const override { return true; }
+	virtual bool CanUserAddOutput() const override { return OutputPins.Num() < FFlowPinBitmask::MaxPins; }
 #endif
 
 protected:
 	virtual void ExecuteInput(const FName& PinName) override;
 	virtual void Cleanup() override;
 
+	virtual void OnLoad_Implementation() override;
+
 #if WITH_EDITOR
 	virtual FString GetNodeDescription() const override;
 #endif
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Nodes/FlowNode.h"
+#include "Types/FlowPinBitmask.h"
 #include "FlowNode_LogicalAND.generated.h"
 
 /**
@@ -15,15 +16,22 @@ class FLOW_API UFlowNode_LogicalAND final : public UFlowNode
 	GENERATED_UCLASS_BODY()
 
 private:
+	// Indexes of executed input pins
 	UPROPERTY(SaveGame)
+	FFlowPinBitmask ExecutedInputs;
+
+	// Deprecated, read only from SaveGames written before ExecutedInputs and migrated on load
+	UPROPERTY(SaveGame, meta = (DeprecatedProperty, DeprecationMessage = "Use the ExecutedInputs instead."))
 	TSet<FName> ExecutedInputNames;
 	
 #if WITH_EDITOR
 public:
-	virtual bool CanUserAddInput() const override { return true; }
+	virtual bool CanUserAddInput() const override { return InputPins.Num() < FFlowPinBitmask::MaxPins; }
 #endif
 
 protected:
 	virtual void ExecuteInput(const FName& PinName) override;
 	virtual void Cleanup() override;
+
+	virtual void OnLoad_Implementation() override;
 };
@@ -37,4 +37,7 @@ protected:
 	virtual void Cleanup() override;
 
 	void ResetCounter();
+
+	static const FName INPIN_Enable;
+	static const FName INPIN_Disable;
 };
@@ -24,6 +24,9 @@ public:
 	// In some cases, the component can be resolved directly
 	void SetResolvedComponentDirect(UActorComponent& Component);
 
+	// Forget the resolved component, i.e. after the injected component was removed or returned to the pool
+	void ClearResolvedComponent() { ResolvedComponent = nullptr; }
+
 	// Returns a the resolved component
 	//  (assumes TryResolveComponent() was called previously)
 	UActorComponent* GetResolvedComponent() const { return ResolvedComponent; }
@@ -37,7 +37,9 @@ public:
 	{
 		OutPinName = Ref.PinName;
 		OutPinFriendlyName = Ref.PinFriendlyName;
+#if WITH_EDITORONLY_DATA
 		OutPinToolTip = Ref.PinToolTip;
+#endif
 	}
 
 	// Recommend implementing AutoConvert_FlowDataPinProperty... for every EFlowPinType
@@ -61,6 +61,11 @@ public:
 	UPROPERTY()
 	bool bRemoveInjectedComponentsWhenDeinitializing = true;
 
+	// Return removed components to UFlowInjectComponentsPool, instead of destroying them
+	// Components of a destroyed actor are never pooled
+	UPROPERTY()
+	bool bReturnComponentsToPool = false;
+
 	// Map of spawned components (if we are cleaning up)
 	UPROPERTY(Transient)
 	TMap<TObjectPtr<AActor>, FFlowComponentInstances> ActorToComponentsMap;
@@ -0,0 +1,70 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "Engine/EngineTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+
+#include "FlowInjectComponentsPool.generated.h"
+
+class AActor;
+class UActorComponent;
+
+// Component kept on the actor for reuse, matched by class and template it was created from
+struct FFlowPooledComponent
+{
+	// Strong reference, as nothing else owns the component after it's removed from actor's owned components
+	TObjectPtr<UActorComponent> Component;
+
+	// Stays valid after component is marked as garbage, so the pooled set can be cleaned up
+	TObjectKey<UActorComponent> ComponentKey;
+
+	TObjectKey<UActorComponent> ComponentTemplate;
+};
+
+/**
+ * Per-world pool of injected components
+ * Instead of being destroyed, released components end play, get unregistered and stay outered to their actor
+ * Pooled components are removed from components owned by the actor, so component lookups on the actor don't find them
+ * Pool keeps them alive until they're acquired again or their actor ends play
+ * Next injection of the same class (or template) on this actor registers the pooled component again
+ * Components aren't moved between actors, as actor is the outer of its components
+ */
+UCLASS()
+class FLOW_API UFlowInjectComponentsPool : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
+	// Returns a previously released component of exactly this class, created from the given template (or without a template)
+	// Returned component isn't registered yet, see FFlowInjectComponentsHelper::InjectCreatedComponent
+	UActorComponent* TryAcquireComponent(AActor& Actor, const UClass& ComponentClass, const UActorComponent* ComponentTemplate);
+
+	// Returns false if the component can't be pooled, caller is expected to destroy it then
+	bool ReleaseComponent(AActor& Actor, UActorComponent& ComponentInstance);
+
+	int32 GetNumPooledComponents() const;
+	bool IsPooled(const UActorComponent& ComponentInstance) const { return PooledComponentKeys.Contains(&ComponentInstance); }
+
+	// Replicated components are destroyed as usual, their replication state isn't preserved while unregistered
+	static bool CanPoolComponent(const UActorComponent& ComponentInstance);
+
+protected:
+	// Drops components of actor ending play, i.e. destroyed or removed with its streamed level, so they can be collected with it
+	UFUNCTION()
+	void OnActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+
+	// Removes actor entry and its OnEndPlay binding once the last pooled component of actor has been acquired
+	void RemoveActorEntry(AActor& Actor);
+
+	TMap<TObjectKey<AActor>, TArray<FFlowPooledComponent>> PooledComponents;
+
+	// Every component currently kept in the pool, tracked explicitly instead of relying on the registration state
+	TSet<TObjectKey<UActorComponent>> PooledComponentKeys;
+};
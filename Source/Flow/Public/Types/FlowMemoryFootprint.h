@@ -0,0 +1,67 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/UnrealString.h"
+
+#if !UE_BUILD_SHIPPING
+class UObject;
+
+/**
+ * Bytes allocated by a Flow Asset, grouped by category
+ * Pins, Connections and Data Pin Payloads are stored in node objects, so Node Objects counts only what's left of nodes after subtracting them
+ */
+struct FLOW_API FFlowMemoryFootprint
+{
+	// Flow Asset object, without its nodes
+	SIZE_T AssetObject = 0;
+
+	SIZE_T NodeObjects = 0;
+	SIZE_T AddOns = 0;
+	SIZE_T Pins = 0;
+	SIZE_T Connections = 0;
+
+	// Pin activations recorded for debugging, never saved
+	SIZE_T PinRecords = 0;
+
+	// Data Pin properties of nodes and the map binding them to pins
+	SIZE_T DataPinPayloads = 0;
+
+	// Records of the loaded save game kept by Flow Subsystem
+	SIZE_T SaveBuffers = 0;
+
+	SIZE_T GetTotal() const;
+	FString ToString() const;
+
+	FFlowMemoryFootprint& operator+=(const FFlowMemoryFootprint& Other);
+
+	// Properties of the object including their heap allocations, and resources reported by GetResourceSizeEx
+	// Subobjects and other referenced objects aren't included
+	static SIZE_T GetObjectBytes(const UObject* Object);
+
+	static FString FormatBytes(const SIZE_T Bytes);
+};
+
+struct FLOW_API FFlowInstanceMemoryReport
+{
+	FString InstanceName;
+	FFlowMemoryFootprint Footprint;
+};
+
+struct FLOW_API FFlowTemplateMemoryReport
+{
+	FString TemplatePath;
+
+	// Template asset is loaded once and shared by all instances
+	FFlowMemoryFootprint TemplateFootprint;
+
+	// Sum of all instances
+	FFlowMemoryFootprint InstancesFootprint;
+
+	// Sorted by total size, largest first
+	TArray<FFlowInstanceMemoryReport> Instances;
+
+	SIZE_T GetTotal() const { return TemplateFootprint.GetTotal() + InstancesFootprint.GetTotal(); }
+};
+#endif
@@ -0,0 +1,63 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "Math/UnrealMathUtility.h"
+#include "FlowPinBitmask.generated.h"
+
+/**
+ * Fixed-width set of pin indexes, used by routing nodes to track which pins were executed
+ * Allocation-free, completion checks are a single mask comparison, saved as a single integer
+ */
+USTRUCT()
+struct FLOW_API FFlowPinBitmask
+{
+	GENERATED_BODY()
+
+	static constexpr int32 MaxPins = 64;
+
+private:
+	UPROPERTY(SaveGame)
+	uint64 Bits = 0;
+
+public:
+	static bool IsValidIndex(const int32 Index) { return Index >= 0 && Index < MaxPins; }
+
+	void Set(const int32 Index) { check(IsValidIndex(Index)); Bits |= uint64(1) << Index; }
+	bool IsSet(const int32 Index) const { return IsValidIndex(Index) && (Bits & (uint64(1) << Index)) != 0; }
+
+	void Reset() { Bits = 0; }
+	bool IsEmpty() const { return Bits == 0; }
+	int32 Num() const { return static_cast<int32>(FMath::CountBits(Bits)); }
+
+	// True if all of the first PinCount indexes are set
+	bool AreAllSet(const int32 PinCount) const
+	{
+		const uint64 Mask = GetMask(PinCount);
+		return (Bits & Mask) == Mask;
+	}
+
+	// Uniformly picks one of the first PinCount indexes that isn't set yet, INDEX_NONE if all are set
+	int32 GetRandomUnsetIndex(const int32 PinCount) const
+	{
+		uint64 Unset = ~Bits & GetMask(PinCount);
+		if (Unset == 0)
+		{
+			return INDEX_NONE;
+		}
+
+		// drop the lowest unset bits until reaching the randomly picked one
+		for (int32 Skip = FMath::RandRange(0, static_cast<int32>(FMath::CountBits(Unset)) - 1); Skip > 0; Skip--)
+		{
+			Unset &= Unset - 1;
+		}
+
+		return static_cast<int32>(FMath::CountTrailingZeros64(Unset));
+	}
+
+private:
+	static uint64 GetMask(const int32 PinCount)
+	{
+		return PinCount >= MaxPins ? ~uint64(0) : (uint64(1) << FMath::Max(0, PinCount)) - 1;
+	}
+};
@@ -0,0 +1,66 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+
+class IFlowPredicateInterface;
+class UFlowNodeAddOn;
+class UFlowNodeAddOn_PredicateNOT;
+
+enum class EFlowPredicateOpCode : uint8
+{
+	SetTrue,
+
+	// Leaf predicate implemented in C++, called directly
+	EvaluateNative,
+	// Leaf predicate implemented (or overriden) in Blueprint, called via Execute_EvaluatePredicate
+	EvaluateBlueprint,
+
+	Not,
+
+	// Short-circuit jumps, skipping the rest of AND/OR composite
+	JumpIfFalse,
+	JumpIfTrue,
+};
+
+struct FFlowPredicateOp
+{
+	EFlowPredicateOpCode OpCode = EFlowPredicateOpCode::SetTrue;
+	int32 JumpTarget = INDEX_NONE;
+
+	const UFlowNodeAddOn* AddOn = nullptr;
+	const IFlowPredicateInterface* NativePredicate = nullptr;
+};
+
+/**
+ * Predicate AddOn tree (AND, OR, NOT composites with leaf predicates) flattened into a linear array of ops
+ * Compiled once on instance initialization, evaluated without recursive UObject dispatch through composites
+ * AddOns are referenced by raw pointers, program must be reset before its AddOns are deinitialized
+ */
+struct FLOW_API FFlowPredicateProgram
+{
+	void CompileAND(const TArray<UFlowNodeAddOn*>& AddOns);
+	void CompileOR(const TArray<UFlowNodeAddOn*>& AddOns);
+	void CompileNOT(const UFlowNodeAddOn_PredicateNOT& PredicateNOT);
+
+	void Reset() { Ops.Reset(); }
+	bool IsCompiled() const { return !Ops.IsEmpty(); }
+
+	bool Evaluate() const;
+
+	// Composites nested in another composite are inlined into the parent's program, no need to compile their own
+	static bool ShouldCompileForComposite(const UFlowNodeAddOn& Composite);
+
+protected:
+	void EmitAddOn(const UFlowNodeAddOn& AddOn);
+	void EmitAND(const TArray<UFlowNodeAddOn*>& AddOns);
+	void EmitOR(const TArray<UFlowNodeAddOn*>& AddOns);
+	void EmitNOT(const UFlowNodeAddOn_PredicateNOT& PredicateNOT);
+
+	int32 EmitJump(const EFlowPredicateOpCode OpCode);
+	void PatchJumpsToEnd(TConstArrayView<int32> JumpOpIndices);
+
+	TArray<FFlowPredicateOp> Ops;
+};
@@ -0,0 +1,82 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "Net/Serialization/FastArraySerializer.h"
+
+#include "FlowTypes.h"
+#include "FlowReplicatedNodeState.generated.h"
+
+class UFlowAsset;
+class UFlowComponent;
+struct FFlowReplicatedNodeStateArray;
+
+// State of a single node of Root Flow instance, as seen by the server
+USTRUCT()
+struct FFlowReplicatedNodeState : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	// Template of the Root Flow instance, assets are net-addressable so it replicates as a compact reference
+	UPROPERTY()
+	TObjectPtr<UFlowAsset> TemplateAsset = nullptr;
+
+	// Name of the Root Flow instance, assigned by Flow Subsystem on creating the instance
+	// Distinguishes instances of the same template started by the component
+	UPROPERTY()
+	FName InstanceName;
+
+	// See UFlowAsset::GetNodeReplicationIndex
+	UPROPERTY()
+	uint16 NodeIndex = 0;
+
+	UPROPERTY()
+	EFlowNodeState State = EFlowNodeState::NeverActivated;
+
+	FFlowReplicatedNodeState() {}
+
+	FFlowReplicatedNodeState(UFlowAsset* InTemplateAsset, const FName InInstanceName, const uint16 InNodeIndex, const EFlowNodeState InState)
+		: TemplateAsset(InTemplateAsset)
+		, InstanceName(InInstanceName)
+		, NodeIndex(InNodeIndex)
+		, State(InState)
+	{
+	}
+
+	void PostReplicatedAdd(const FFlowReplicatedNodeStateArray& InArraySerializer);
+	void PostReplicatedChange(const FFlowReplicatedNodeStateArray& InArraySerializer);
+	void PreReplicatedRemove(const FFlowReplicatedNodeStateArray& InArraySerializer);
+};
+
+// Delta-serialized set of active and finished nodes, for all Root Flow instances created by the Flow Component
+USTRUCT()
+struct FLOW_API FFlowReplicatedNodeStateArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FFlowReplicatedNodeState> Items;
+
+	// Component owning this array, receives client-side notifications
+	UFlowComponent* OwnerComponent = nullptr;
+
+	const FFlowReplicatedNodeState* Find(const FName InstanceName, const uint16 NodeIndex) const;
+
+	// Returns true if the array has been modified
+	bool SetState(UFlowAsset* TemplateAsset, const FName InstanceName, const uint16 NodeIndex, const EFlowNodeState State);
+	bool RemoveAll(const FName InstanceName);
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FastArrayDeltaSerialize<FFlowReplicatedNodeState, FFlowReplicatedNodeStateArray>(Items, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FFlowReplicatedNodeStateArray> : public TStructOpsTypeTraitsBase2<FFlowReplicatedNodeStateArray>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
@@ -0,0 +1,62 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "Math/Box.h"
+#include "Math/IntPoint.h"
+#include "Math/Vector.h"
+#include "Templates/Function.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UFlowComponent;
+
+/**
+ * Uniform 2D hash grid of registered Flow Components, used by spatial queries of the Flow Subsystem
+ * Cells are laid out on the XY plane, Z is only used for exact distance checks, as open worlds are mostly flat
+ * Locations are cached on update, so queries don't touch components outside of visited cells
+ */
+class FLOW_API FFlowSpatialGrid
+{
+public:
+	explicit FFlowSpatialGrid(const float InCellSize);
+
+	void Add(UFlowComponent* Component, const FVector& Location);
+
+	// Moves the component to another cell only if it crossed the cell boundary
+	void Update(UFlowComponent* Component, const FVector& Location);
+	void Remove(UFlowComponent* Component);
+	void Reset();
+
+	bool Contains(const UFlowComponent* Component) const { return Entries.Contains(Component); }
+	int32 Num() const { return Entries.Num(); }
+	float GetCellSize() const { return CellSize; }
+
+	using FFilter = TFunctionRef<bool(const UFlowComponent&)>;
+
+	void QuerySphere(const FVector& Center, const float Radius, FFilter Filter, TArray<UFlowComponent*>& OutComponents) const;
+	void QueryBox(const FBox& Bounds, FFilter Filter, TArray<UFlowComponent*>& OutComponents) const;
+
+	// Visits rings of cells around the location, stops as soon as no closer component can be found in further rings
+	// Scans all occupied cells instead if that's cheaper than visiting the rings, always for MaxDistance <= 0 meaning unlimited search
+	UFlowComponent* FindNearest(const FVector& Location, const float MaxDistance, FFilter Filter) const;
+
+private:
+	struct FEntry
+	{
+		FIntPoint Cell;
+		FVector Location;
+	};
+
+	FIntPoint GetCell(const FVector& Location) const;
+	void AddToCell(const FIntPoint& Cell, UFlowComponent* Component);
+	void RemoveFromCell(const FIntPoint& Cell, UFlowComponent* Component);
+
+	float CellSize;
+
+	TMap<FIntPoint, TArray<TWeakObjectPtr<UFlowComponent>>> Cells;
+	TMap<TWeakObjectPtr<const UFlowComponent>, FEntry> Entries;
+
+	// Extent of cells occupied so far, limits rings visited by nearest search. Not shrunk on removal
+	FIntPoint MinCell;
+	FIntPoint MaxCell;
+};
@@ -71,6 +71,9 @@ void FFlowAssetEditor::PostRedo(bool bSuccess)
 
 void FFlowAssetEditor::HandleUndoTransaction()
 {
+	// Transaction might have restored any pin links
+	FlowAsset->MarkAllNodeConnectionsDirty();
+
 	SetUISelectionState(NAME_None);
 	GraphEditor->NotifyGraphChanged();
 	FSlateApplication::Get().DismissAllMenus();
@@ -0,0 +1,501 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "Commandlets/FlowBenchmarkCommandlet.h"
+#include "FlowEditorLogChannels.h"
+#include "Graph/FlowGraph.h"
+#include "Graph/FlowGraphSchema_Actions.h"
+#include "Graph/Nodes/FlowGraphNode.h"
+
+#include "FlowAsset.h"
+#include "FlowComponent.h"
+#include "FlowSave.h"
+#include "FlowSubsystem.h"
+#include "Nodes/FlowPin.h"
+#include "Nodes/Route/FlowNode_Reroute.h"
+#include "Types/FlowEnumUtils.h"
+
+#include "Dom/JsonObject.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameplayTagContainer.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(FlowBenchmarkCommandlet)
+
+void FFlowBenchmarkResult::AddSample(const double Seconds, const int32 Operations /* = 1 */)
+{
+	if (Operations <= 0)
+	{
+		return;
+	}
+
+	const double SecondsPerOperation = Seconds / Operations;
+	Samples += Operations;
+	TotalSeconds += Seconds;
+	MinSeconds = FMath::Min(MinSeconds, SecondsPerOperation);
+	MaxSeconds = FMath::Max(MaxSeconds, SecondsPerOperation);
+}
+
+double FFlowBenchmarkResult::GetAverageMicroseconds() const
+{
+	return Samples > 0 ? TotalSeconds * 1000000.0 / Samples : 0.0;
+}
+
+UFlowBenchmarkCommandlet::UFlowBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UFlowBenchmarkCommandlet::Main(const FString& Params)
+{
+	FString AssetsParam;
+	FParse::Value(*Params, TEXT("Assets="), AssetsParam);
+
+	FString SyntheticParam;
+	FParse::Value(*Params, TEXT("Synthetic="), SyntheticParam);
+
+	int32 InstanceCount = 100;
+	FParse::Value(*Params, TEXT("Instances="), InstanceCount);
+	InstanceCount = FMath::Max(1, InstanceCount);
+
+	int32 Iterations = 10;
+	FParse::Value(*Params, TEXT("Iterations="), Iterations);
+	Iterations = FMath::Max(1, Iterations);
+
+	FString ComponentsParam = TEXT("1000");
+	FParse::Value(*Params, TEXT("Components="), ComponentsParam);
+
+	FString TagName;
+	FParse::Value(*Params, TEXT("Tag="), TagName);
+
+	FString OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("FlowBenchmark.csv"));
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	// gather templates, paired with the number of pin hops executed on start (known only for synthetic graphs)
+	TArray<TPair<UFlowAsset*, int32>> Templates;
+
+	TArray<FString> AssetPaths;
+	AssetsParam.ParseIntoArray(AssetPaths, TEXT("+"));
+	for (const FString& AssetPath : AssetPaths)
+	{
+		if (UFlowAsset* FlowAsset = LoadObject<UFlowAsset>(nullptr, *AssetPath))
+		{
+			FlowAsset->AddToRoot();
+			Templates.Emplace(FlowAsset, 0);
+		}
+		else
+		{
+			UE_LOG(LogFlowEditor, Error, TEXT("FlowBenchmark: failed to load Flow Asset %s"), *AssetPath);
+		}
+	}
+
+	TArray<FString> SyntheticSizes;
+	SyntheticParam.ParseIntoArray(SyntheticSizes, TEXT("+"));
+	for (const FString& SyntheticSize : SyntheticSizes)
+	{
+		const int32 NodeCount = FCString::Atoi(*SyntheticSize);
+		if (NodeCount > 0)
+		{
+			UFlowAsset* FlowAsset = CreateSyntheticAsset(NodeCount);
+			FlowAsset->AddToRoot();
+			Templates.Emplace(FlowAsset, NodeCount);
+		}
+	}
+
+	if (Templates.IsEmpty())
+	{
+		UE_LOG(LogFlowEditor, Error, TEXT("FlowBenchmark: nothing to measure, provide -Assets= or -Synthetic="));
+		return 1;
+	}
+
+	// headless game instance hosting the Flow Subsystem
+	UGameInstance* GameInstance = NewObject<UGameInstance>(GEngine);
+	GameInstance->InitializeStandalone();
+
+	UWorld* World = GameInstance->GetWorld();
+	UFlowSubsystem* FlowSubsystem = GameInstance->GetSubsystem<UFlowSubsystem>();
+	if (World == nullptr || FlowSubsystem == nullptr)
+	{
+		UE_LOG(LogFlowEditor, Error, TEXT("FlowBenchmark: failed to create Flow Subsystem"));
+		GameInstance->Shutdown();
+		return 1;
+	}
+
+	// root flows are unique per Owner and template, so every instance needs its own Owner
+	TArray<AActor*> Owners;
+	Owners.Reserve(InstanceCount);
+	for (int32 Index = 0; Index < InstanceCount; Index++)
+	{
+		Owners.Emplace(World->SpawnActor<AActor>());
+	}
+
+	for (const TPair<UFlowAsset*, int32>& Template : Templates)
+	{
+		BenchmarkTemplate(FlowSubsystem, Template.Key, Owners, Iterations, Template.Value);
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	TArray<FString> ComponentCounts;
+	ComponentsParam.ParseIntoArray(ComponentCounts, TEXT("+"));
+	for (const FString& ComponentCount : ComponentCounts)
+	{
+		BenchmarkRegistry(FlowSubsystem, World, FCString::Atoi(*ComponentCount), TagName, Iterations);
+	}
+
+	for (AActor* Owner : Owners)
+	{
+		Owner->Destroy();
+	}
+
+	GameInstance->Shutdown();
+
+	for (const TPair<UFlowAsset*, int32>& Template : Templates)
+	{
+		Template.Key->RemoveFromRoot();
+	}
+
+	for (const FFlowBenchmarkResult& Result : Results)
+	{
+		UE_LOG(LogFlowEditor, Display, TEXT("FlowBenchmark: %s | %s | nodes %d | samples %d | avg %.3f us | min %.3f us | max %.3f us"),
+			*Result.Asset, *Result.Metric, Result.NodeCount, Result.Samples, Result.GetAverageMicroseconds(), Result.GetMinMicroseconds(), Result.GetMaxMicroseconds());
+	}
+
+	return WriteReport(OutputPath) ? 0 : 1;
+}
+
+void UFlowBenchmarkCommandlet::BenchmarkTemplate(UFlowSubsystem* FlowSubsystem, UFlowAsset* Template, const TArray<AActor*>& Owners, const int32 Iterations, const int32 HopCount)
+{
+	// synthetic graphs share a name, so results of different sizes line up in the report
+	const FString AssetName = HopCount > 0 ? TEXT("Synthetic") : Template->GetPathName();
+	const int32 NodeCount = Template->GetNodes().Num();
+
+	FFlowBenchmarkResult CreateResult(AssetName, TEXT("CreateFlowInstance"), NodeCount);
+	FFlowBenchmarkResult StartResult(AssetName, TEXT("StartFlow"), NodeCount);
+	FFlowBenchmarkResult PinHopResult(AssetName, TEXT("PinHop"), NodeCount);
+	FFlowBenchmarkResult DataPinResult(AssetName, TEXT("DataPinResolution"), NodeCount);
+	FFlowBenchmarkResult SaveResult(AssetName, TEXT("SaveInstance"), NodeCount);
+	FFlowBenchmarkResult LoadResult(AssetName, TEXT("LoadInstance"), NodeCount);
+	FFlowBenchmarkResult StartRootFlowResult(AssetName, TEXT("StartRootFlow"), NodeCount);
+
+	TArray<UFlowAsset*> Instances;
+	Instances.Reserve(Owners.Num());
+
+	TArray<TPair<AActor*, FString>> SavedInstances;
+	SavedInstances.Reserve(Owners.Num());
+
+	for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+	{
+		Instances.Reset();
+		SavedInstances.Reset();
+
+		// instantiation only
+		for (AActor* Owner : Owners)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			UFlowAsset* Instance = FlowSubsystem->CreateRootFlow(Owner, Template, true);
+			CreateResult.AddSample(FPlatformTime::Seconds() - StartTime);
+
+			if (Instance)
+			{
+				Instances.Emplace(Instance);
+				SavedInstances.Emplace(Owner, Instance->GetName());
+			}
+		}
+
+		// execution of already created instances, synthetic graphs trigger a known number of pins
+		for (UFlowAsset* Instance : Instances)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			Instance->StartFlow();
+			const double Elapsed = FPlatformTime::Seconds() - StartTime;
+
+			StartResult.AddSample(Elapsed);
+			if (HopCount > 0)
+			{
+				PinHopResult.AddSample(Elapsed, HopCount);
+			}
+		}
+
+		for (const UFlowAsset* Instance : Instances)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			const int32 ResolvedPins = ResolveAllDataPins(Instance);
+			DataPinResult.AddSample(FPlatformTime::Seconds() - StartTime, ResolvedPins);
+		}
+
+		// SaveInstance through the regular save game path
+		UFlowSaveGame* SaveGame = NewObject<UFlowSaveGame>(GetTransientPackage());
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			FlowSubsystem->OnGameSaved(SaveGame);
+			SaveResult.AddSample(FPlatformTime::Seconds() - StartTime, Instances.Num());
+		}
+
+		for (AActor* Owner : Owners)
+		{
+			FlowSubsystem->FinishRootFlow(Owner, Template, EFlowFinishPolicy::Abort);
+		}
+
+		// LoadInstance, including creation of the restored instance
+		FlowSubsystem->OnGameLoaded(SaveGame);
+		for (const TPair<AActor*, FString>& SavedInstance : SavedInstances)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			FlowSubsystem->LoadRootFlow(SavedInstance.Key, Template, SavedInstance.Value, true);
+			LoadResult.AddSample(FPlatformTime::Seconds() - StartTime);
+		}
+
+		for (AActor* Owner : Owners)
+		{
+			FlowSubsystem->FinishRootFlow(Owner, Template, EFlowFinishPolicy::Abort);
+		}
+
+		// full path used by gameplay code
+		for (AActor* Owner : Owners)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			FlowSubsystem->StartRootFlow(Owner, Template, true);
+			StartRootFlowResult.AddSample(FPlatformTime::Seconds() - StartTime);
+		}
+
+		for (AActor* Owner : Owners)
+		{
+			FlowSubsystem->FinishRootFlow(Owner, Template, EFlowFinishPolicy::Abort);
+		}
+	}
+
+	Results.Emplace(MoveTemp(CreateResult));
+	Results.Emplace(MoveTemp(StartResult));
+	if (HopCount > 0)
+	{
+		Results.Emplace(MoveTemp(PinHopResult));
+	}
+	if (DataPinResult.Samples > 0)
+	{
+		Results.Emplace(MoveTemp(DataPinResult));
+	}
+	Results.Emplace(MoveTemp(SaveResult));
+	Results.Emplace(MoveTemp(LoadResult));
+	Results.Emplace(MoveTemp(StartRootFlowResult));
+}
+
+void UFlowBenchmarkCommandlet::BenchmarkRegistry(UFlowSubsystem* FlowSubsystem, UWorld* World, const int32 ComponentCount, const FString& TagName, const int32 Iterations)
+{
+	const FGameplayTag Tag = FGameplayTag::RequestGameplayTag(FName(*TagName), false);
+	if (!Tag.IsValid() || ComponentCount <= 0)
+	{
+		UE_LOG(LogFlowEditor, Display, TEXT("FlowBenchmark: skipping registry queries, -Tag= doesn't point to a valid Gameplay Tag"));
+		return;
+	}
+
+	TArray<AActor*> Actors;
+	Actors.Reserve(ComponentCount);
+	for (int32 Index = 0; Index < ComponentCount; Index++)
+	{
+		AActor* Actor = World->SpawnActor<AActor>();
+		UFlowComponent* Component = NewObject<UFlowComponent>(Actor);
+		Component->IdentityTags.AddTag(Tag);
+		Component->RegisterComponent();
+		FlowSubsystem->RegisterComponent(Component);
+
+		Actors.Emplace(Actor);
+	}
+
+	const FString AssetName = FString::Printf(TEXT("Registry:%s"), *Tag.ToString());
+	FFlowBenchmarkResult ComponentsByTagResult(AssetName, TEXT("GetFlowComponentsByTag"), ComponentCount);
+	FFlowBenchmarkResult ComponentsResult(AssetName, TEXT("GetComponents"), ComponentCount);
+	FFlowBenchmarkResult ActorsResult(AssetName, TEXT("GetFlowActorsByTag"), ComponentCount);
+
+	for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+	{
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			const TSet<UFlowComponent*> Found = FlowSubsystem->GetFlowComponentsByTag(Tag, UFlowComponent::StaticClass(), true);
+			ComponentsByTagResult.AddSample(FPlatformTime::Seconds() - StartTime);
+		}
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			const TSet<TWeakObjectPtr<UFlowComponent>> Found = FlowSubsystem->GetComponents<UFlowComponent>(Tag, true);
+			ComponentsResult.AddSample(FPlatformTime::Seconds() - StartTime);
+		}
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			const TSet<AActor*> Found = FlowSubsystem->GetFlowActorsByTag(Tag, AActor::StaticClass(), true);
+			ActorsResult.AddSample(FPlatformTime::Seconds() - StartTime);
+		}
+	}
+
+	Results.Emplace(MoveTemp(ComponentsByTagResult));
+	Results.Emplace(MoveTemp(ComponentsResult));
+	Results.Emplace(MoveTemp(ActorsResult));
+
+	for (AActor* Actor : Actors)
+	{
+		if (UFlowComponent* Component = Actor->FindComponentByClass<UFlowComponent>())
+		{
+			FlowSubsystem->UnregisterComponent(Component);
+		}
+		Actor->Destroy();
+	}
+}
+
+UFlowAsset* UFlowBenchmarkCommandlet::CreateSyntheticAsset(const int32 NodeCount)
+{
+	const FName AssetName = MakeUniqueObjectName(GetTransientPackage(), UFlowAsset::StaticClass(), *FString::Printf(TEXT("FA_FlowBenchmark_%d"), NodeCount));
+	UFlowAsset* FlowAsset = NewObject<UFlowAsset>(GetTransientPackage(), AssetName, RF_Transient);
+	UFlowGraph::CreateGraph(FlowAsset);
+
+	// Start -> Reroute -> Reroute -> ...
+	UEdGraphPin* FromPin = nullptr;
+	if (const UFlowGraphNode* StartGraphNode = Cast<UFlowGraphNode>(FlowAsset->GetDefaultEntryNode()->GetGraphNode()))
+	{
+		FromPin = StartGraphNode->OutputPins.IsEmpty() ? nullptr : StartGraphNode->OutputPins[0];
+	}
+
+	for (int32 Index = 0; Index < NodeCount; Index++)
+	{
+		const FVector2D Location(256.0f * (Index + 1), 0.0f);
+		const UFlowGraphNode* NewGraphNode = FFlowGraphSchemaAction_NewNode::CreateNode(FlowAsset->GetGraph(), FromPin, UFlowNode_Reroute::StaticClass(), Location, false);
+		FromPin = NewGraphNode->OutputPins.IsEmpty() ? nullptr : NewGraphNode->OutputPins[0];
+	}
+
+	FlowAsset->HarvestNodeConnections();
+	return FlowAsset;
+}
+
+int32 UFlowBenchmarkCommandlet::ResolveAllDataPins(const UFlowAsset* FlowInstance)
+{
+	int32 ResolvedPins = 0;
+
+	for (const TPair<FGuid, UFlowNode*>& Node : FlowInstance->GetNodes())
+	{
+		for (const FFlowPin& Pin : Node.Value->GetInputPins())
+		{
+			if (!Pin.IsDataPin())
+			{
+				continue;
+			}
+
+			FLOW_ASSERT_ENUM_MAX(EFlowPinType, 16);
+
+			switch (Pin.GetPinType())
+			{
+			case EFlowPinType::Bool:
+				Node.Value->TryResolveDataPinAsBool(Pin.PinName);
+				break;
+			case EFlowPinType::Int:
+				Node.Value->TryResolveDataPinAsInt(Pin.PinName);
+				break;
+			case EFlowPinType::Float:
+				Node.Value->TryResolveDataPinAsFloat(Pin.PinName);
+				break;
+			case EFlowPinType::Name:
+				Node.Value->TryResolveDataPinAsName(Pin.PinName);
+				break;
+			case EFlowPinType::String:
+				Node.Value->TryResolveDataPinAsString(Pin.PinName);
+				break;
+			case EFlowPinType::Text:
+				Node.Value->TryResolveDataPinAsText(Pin.PinName);
+				break;
+			case EFlowPinType::Enum:
+				Node.Value->TryResolveDataPinAsEnum(Pin.PinName);
+				break;
+			case EFlowPinType::Vector:
+				Node.Value->TryResolveDataPinAsVector(Pin.PinName);
+				break;
+			case EFlowPinType::Rotator:
+				Node.Value->TryResolveDataPinAsRotator(Pin.PinName);
+				break;
+			case EFlowPinType::Transform:
+				Node.Value->TryResolveDataPinAsTransform(Pin.PinName);
+				break;
+			case EFlowPinType::GameplayTag:
+				Node.Value->TryResolveDataPinAsGameplayTag(Pin.PinName);
+				break;
+			case EFlowPinType::GameplayTagContainer:
+				Node.Value->TryResolveDataPinAsGameplayTagContainer(Pin.PinName);
+				break;
+			case EFlowPinType::InstancedStruct:
+				Node.Value->TryResolveDataPinAsInstancedStruct(Pin.PinName);
+				break;
+			case EFlowPinType::Object:
+				Node.Value->TryResolveDataPinAsObject(Pin.PinName);
+				break;
+			case EFlowPinType::Class:
+				Node.Value->TryResolveDataPinAsClass(Pin.PinName);
+				break;
+			default:
+				continue;
+			}
+
+			ResolvedPins++;
+		}
+	}
+
+	return ResolvedPins;
+}
+
+bool UFlowBenchmarkCommandlet::WriteReport(const FString& OutputPath) const
+{
+	const bool bJson = FPaths::GetExtension(OutputPath).Equals(TEXT("json"), ESearchCase::IgnoreCase);
+	const FString Report = bJson ? ToJSON() : ToCSV();
+
+	if (!FFileHelper::SaveStringToFile(Report, *OutputPath))
+	{
+		UE_LOG(LogFlowEditor, Error, TEXT("FlowBenchmark: failed to write report to %s"), *OutputPath);
+		return false;
+	}
+
+	UE_LOG(LogFlowEditor, Display, TEXT("FlowBenchmark: report written to %s"), *OutputPath);
+	return true;
+}
+
+FString UFlowBenchmarkCommandlet::ToCSV() const
+{
+	FString Report = TEXT("Asset,Metric,NodeCount,Samples,TotalMs,AvgUs,MinUs,MaxUs\n");
+	for (const FFlowBenchmarkResult& Result : Results)
+	{
+		Report += FString::Printf(TEXT("%s,%s,%d,%d,%.4f,%.4f,%.4f,%.4f\n"),
+			*Result.Asset, *Result.Metric, Result.NodeCount, Result.Samples, Result.TotalSeconds * 1000.0,
+			Result.GetAverageMicroseconds(), Result.GetMinMicroseconds(), Result.GetMaxMicroseconds());
+	}
+	return Report;
+}
+
+FString UFlowBenchmarkCommandlet::ToJSON() const
+{
+	TArray<TSharedPtr<FJsonValue>> Rows;
+	for (const FFlowBenchmarkResult& Result : Results)
+	{
+		const TSharedRef<FJsonObject> Row = MakeShared<FJsonObject>();
+		Row->SetStringField(TEXT("asset"), Result.Asset);
+		Row->SetStringField(TEXT("metric"), Result.Metric);
+		Row->SetNumberField(TEXT("nodeCount"), Result.NodeCount);
+		Row->SetNumberField(TEXT("samples"), Result.Samples);
+		Row->SetNumberField(TEXT("totalMs"), Result.TotalSeconds * 1000.0);
+		Row->SetNumberField(TEXT("avgUs"), Result.GetAverageMicroseconds());
+		Row->SetNumberField(TEXT("minUs"), Result.GetMinMicroseconds());
+		Row->SetNumberField(TEXT("maxUs"), Result.GetMaxMicroseconds());
+		Rows.Emplace(MakeShared<FJsonValueObject>(Row));
+	}
+
+	const TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetArrayField(TEXT("results"), Rows);
+
+	FString Report;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Report);
+	FJsonSerializer::Serialize(Root, Writer);
+	return Report;
+}
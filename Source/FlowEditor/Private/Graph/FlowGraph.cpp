@@ -126,7 +126,7 @@ void UFlowGraph::NotifyGraphChanged()
 {
 	if (UFlowAsset* FlowAsset = GetFlowAsset())
 	{
-		FlowAsset->HarvestNodeConnections();
+		FlowAsset->HarvestDirtyNodeConnections();
 	}
 
 	Super::NotifyGraphChanged();
@@ -323,12 +323,30 @@ void UFlowGraphNode::ReconstructNode()
 
 		TArray<UEdGraphPin*> OldPins(Pins);
 
+		// Linked nodes harvested connections to pins that are about to be recreated, renamed or removed
+		TSet<FGuid> LinkedNodeGuids;
+		auto GatherLinkedNodes = [&LinkedNodeGuids](const TArray<UEdGraphPin*>& InPins)
+		{
+			for (const UEdGraphPin* Pin : InPins)
+			{
+				for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+				{
+					if (LinkedPin && LinkedPin->GetOwningNodeUnchecked())
+					{
+						LinkedNodeGuids.Add(LinkedPin->GetOwningNodeUnchecked()->NodeGuid);
+					}
+				}
+			}
+		};
+		GatherLinkedNodes(OldPins);
+
 		Pins.Reset();
 		InputPins.Reset();
 		OutputPins.Reset();
 
 		AllocateDefaultPins();
 		RewireOldPinsToNewPins(OldPins);
+		GatherLinkedNodes(Pins);
 
 		// Destroy old pins
 		for (UEdGraphPin* OldPin : OldPins)
@@ -345,6 +363,20 @@ void UFlowGraphNode::ReconstructNode()
 		}
 
 		bNeedsFullReconstruction = false;
+
+		// Pins were recreated, harvested on the next graph change or Flow instantiation
+		if (const UFlowNode* FlowNode = Cast<UFlowNode>(GetFlowNodeBase()))
+		{
+			if (UFlowAsset* FlowAsset = FlowNode->GetFlowAsset())
+			{
+				FlowAsset->MarkNodeConnectionsDirty(FlowNode->GetGuid());
+
+				for (const FGuid& LinkedNodeGuid : LinkedNodeGuids)
+				{
+					FlowAsset->MarkNodeConnectionsDirty(LinkedNodeGuid);
+				}
+			}
+		}
 	}
 
 	// This ensures the graph editor 'Refresh' button still rebuilds all the graph widgets even if the FlowGraphNode has nothing to update
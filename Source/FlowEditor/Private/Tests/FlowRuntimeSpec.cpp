@@ -0,0 +1,488 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "Graph/FlowGraph.h"
+#include "Graph/FlowGraphSchema_Actions.h"
+#include "Graph/Nodes/FlowGraphNode.h"
+
+#include "FlowAsset.h"
+#include "FlowComponent.h"
+#include "FlowSave.h"
+#include "FlowSubsystem.h"
+#include "Nodes/Developer/FlowNode_Log.h"
+#include "Nodes/Graph/FlowNode_FormatText.h"
+#include "Nodes/Route/FlowNode_Counter.h"
+#include "Nodes/Route/FlowNode_Reroute.h"
+#include "Types/FlowDataPinProperties.h"
+
+#include "EdGraph/EdGraphSchema.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Misc/AutomationTest.h"
+#include "NativeGameplayTags.h"
+#include "UObject/Package.h"
+#include "UObject/UnrealType.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_FlowRuntimeSpec_Matching, "Flow.Tests.Runtime.Matching");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_FlowRuntimeSpec_Other, "Flow.Tests.Runtime.Other");
+
+/**
+ * Headless checks of the Flow runtime, run with:
+ * UnrealEditor-Cmd.exe <Project> -ExecCmds="Automation RunTests Flow.Runtime; Quit" -unattended -nullrhi
+ *
+ * Scaling tests repeat the same scenario for every size in GraphSizes and assert that per-hop or per-query operation counts stay the same,
+ * so a linear scan added to a hot path shows up as a failed test. Timings are measured by the FlowBenchmark commandlet.
+ */
+BEGIN_DEFINE_SPEC(FFlowRuntimeSpec, "Flow.Runtime", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+	// Reroute nodes placed between Start and Counter in tests of a single graph, each one is a single pin hop
+	static constexpr int32 DefaultHopCount = 16;
+
+	// Hop counts of graphs, and numbers of registered components, compared by scaling tests
+	static constexpr int32 GraphSizes[] = {16, 256, 4096};
+
+	// Components matching the queried tag, registered next to a growing number of other components
+	static constexpr int32 MatchingComponentCount = 4;
+
+	// Value of the Format Text named property, supplied to the Log node through the data pin
+	static constexpr const TCHAR* FormattedValue = TEXT("Flow");
+
+	UGameInstance* GameInstance = nullptr;
+	UWorld* World = nullptr;
+	UFlowSubsystem* FlowSubsystem = nullptr;
+	AActor* Owner = nullptr;
+	UFlowAsset* Template = nullptr;
+
+	// Templates and actors created by the test, released after each test
+	TArray<UFlowAsset*> CreatedTemplates;
+	TArray<AActor*> SpawnedActors;
+
+	FGuid CounterGuid;
+	FGuid LogGuid;
+
+	// Start -> Reroute x HopCount -> Counter, and Format Text feeding the Message data pin of a Log node
+	UFlowAsset* CreateTemplate(const int32 HopCount);
+
+	// Actor with a registered Flow Component, as if it was placed in the level
+	UFlowComponent* SpawnFlowComponent(const FGameplayTag& IdentityTag);
+
+	static int32 GetCounterSum(const UFlowNode* CounterNode);
+	static int32 GetTriggeredInputCount(const UFlowAsset* FlowInstance);
+
+END_DEFINE_SPEC(FFlowRuntimeSpec)
+
+UFlowAsset* FFlowRuntimeSpec::CreateTemplate(const int32 HopCount)
+{
+	const FName AssetName = MakeUniqueObjectName(GetTransientPackage(), UFlowAsset::StaticClass(), TEXT("FA_FlowRuntimeSpec"));
+	UFlowAsset* FlowAsset = NewObject<UFlowAsset>(GetTransientPackage(), AssetName, RF_Transient);
+	FlowAsset->AddToRoot();
+	CreatedTemplates.Add(FlowAsset);
+
+	UFlowGraph::CreateGraph(FlowAsset);
+	UEdGraph* Graph = FlowAsset->GetGraph();
+
+	UEdGraphPin* FromPin = nullptr;
+	if (const UFlowGraphNode* StartGraphNode = Cast<UFlowGraphNode>(FlowAsset->GetDefaultEntryNode()->GetGraphNode()))
+	{
+		FromPin = StartGraphNode->OutputPins.IsEmpty() ? nullptr : StartGraphNode->OutputPins[0];
+	}
+
+	for (int32 Index = 0; Index < HopCount; Index++)
+	{
+		const UFlowGraphNode* RerouteGraphNode = FFlowGraphSchemaAction_NewNode::CreateNode(Graph, FromPin, UFlowNode_Reroute::StaticClass(), FVector2D(256.0f * (Index + 1), 0.0f), false);
+		FromPin = RerouteGraphNode->OutputPins.IsEmpty() ? nullptr : RerouteGraphNode->OutputPins[0];
+	}
+
+	// connected to the first input pin, Increment
+	const UFlowGraphNode* CounterGraphNode = FFlowGraphSchemaAction_NewNode::CreateNode(Graph, FromPin, UFlowNode_Counter::StaticClass(), FVector2D(256.0f * (HopCount + 1), 0.0f), false);
+	CounterGuid = CounterGraphNode->NodeGuid;
+
+	// data pins only, Log isn't connected to execution
+	UFlowGraphNode* FormatTextGraphNode = FFlowGraphSchemaAction_NewNode::CreateNode(Graph, nullptr, UFlowNode_FormatText::StaticClass(), FVector2D(0.0f, 256.0f), false);
+	UFlowGraphNode* LogGraphNode = FFlowGraphSchemaAction_NewNode::CreateNode(Graph, nullptr, UFlowNode_Log::StaticClass(), FVector2D(256.0f, 256.0f), false);
+	LogGuid = LogGraphNode->NodeGuid;
+
+	// "{Value}" formatted with a named String property, as the format fails without any named property
+	UFlowNodeBase* FormatTextNode = FormatTextGraphNode->GetFlowNodeBase();
+	const FArrayProperty* NamedPropertiesProperty = FindFProperty<FArrayProperty>(UFlowNode_DefineProperties::StaticClass(), TEXT("NamedProperties"));
+	const UScriptStruct* StringPropertyStruct = FindObject<UScriptStruct>(nullptr, TEXT("/Script/Flow.FlowDataPinInputProperty_String"));
+	if (NamedPropertiesProperty && StringPropertyStruct)
+	{
+		FFlowNamedDataPinProperty NamedProperty;
+		NamedProperty.Name = TEXT("Value");
+		NamedProperty.DataPinProperty.InitializeAsScriptStruct(StringPropertyStruct);
+
+		if (const FStrProperty* ValueProperty = FindFProperty<FStrProperty>(StringPropertyStruct, TEXT("Value")))
+		{
+			ValueProperty->SetPropertyValue_InContainer(NamedProperty.DataPinProperty.GetMutablePtr<FFlowDataPinProperty>(), FormattedValue);
+		}
+
+		NamedPropertiesProperty->ContainerPtrToValuePtr<TArray<FFlowNamedDataPinProperty>>(FormatTextNode)->Add(MoveTemp(NamedProperty));
+	}
+
+	if (const FTextProperty* FormatTextProperty = FindFProperty<FTextProperty>(UFlowNode_FormatText::StaticClass(), TEXT("FormatText")))
+	{
+		FormatTextProperty->SetPropertyValue_InContainer(FormatTextNode, FText::FromString(TEXT("{Value}")));
+	}
+
+	// generates the data pin of the named property
+	FormatTextGraphNode->ReconstructNode();
+
+	UEdGraphPin* FormattedTextPin = FormatTextGraphNode->FindPin(UFlowNode_FormatText::OUTPIN_TextOutput, EGPD_Output);
+	UEdGraphPin* MessagePin = LogGraphNode->FindPin(TEXT("Message"), EGPD_Input);
+	if (FormattedTextPin && MessagePin)
+	{
+		Graph->GetSchema()->TryCreateConnection(FormattedTextPin, MessagePin);
+	}
+
+	FlowAsset->HarvestNodeConnections();
+	return FlowAsset;
+}
+
+UFlowComponent* FFlowRuntimeSpec::SpawnFlowComponent(const FGameplayTag& IdentityTag)
+{
+	AActor* Actor = World->SpawnActor<AActor>();
+	SpawnedActors.Add(Actor);
+
+	UFlowComponent* Component = NewObject<UFlowComponent>(Actor);
+	Component->AddIdentityTag(IdentityTag);
+	Component->RegisterComponent();
+
+	// registers the component with the Flow Subsystem, the headless world never begins play on its own
+	Actor->DispatchBeginPlay();
+	return Component;
+}
+
+int32 FFlowRuntimeSpec::GetCounterSum(const UFlowNode* CounterNode)
+{
+	const FIntProperty* SumProperty = FindFProperty<FIntProperty>(UFlowNode_Counter::StaticClass(), TEXT("CurrentSum"));
+	return SumProperty && CounterNode ? SumProperty->GetPropertyValue_InContainer(CounterNode) : INDEX_NONE;
+}
+
+int32 FFlowRuntimeSpec::GetTriggeredInputCount(const UFlowAsset* FlowInstance)
+{
+	int32 TriggeredInputs = 0;
+
+	for (const TPair<FGuid, UFlowNode*>& Node : FlowInstance->GetNodes())
+	{
+		for (const FFlowPin& Pin : Node.Value->GetInputPins())
+		{
+			TriggeredInputs += Node.Value->GetPinRecords(Pin.PinName, EGPD_Input).Num();
+		}
+	}
+
+	return TriggeredInputs;
+}
+
+void FFlowRuntimeSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		// headless game instance hosting the Flow Subsystem, no rendering required
+		GameInstance = NewObject<UGameInstance>(GEngine);
+		GameInstance->AddToRoot();
+		GameInstance->InitializeStandalone();
+
+		FlowSubsystem = GameInstance->GetSubsystem<UFlowSubsystem>();
+		World = GameInstance->GetWorld();
+		Owner = World ? World->SpawnActor<AActor>() : nullptr;
+	});
+
+	AfterEach([this]()
+	{
+		if (FlowSubsystem && Owner)
+		{
+			for (UFlowAsset* CreatedTemplate : CreatedTemplates)
+			{
+				FlowSubsystem->FinishRootFlow(Owner, CreatedTemplate, EFlowFinishPolicy::Abort);
+			}
+		}
+
+		// unregisters Flow Components before the subsystem goes away
+		for (AActor* SpawnedActor : SpawnedActors)
+		{
+			SpawnedActor->Destroy();
+		}
+		SpawnedActors.Empty();
+
+		if (Owner)
+		{
+			Owner->Destroy();
+			Owner = nullptr;
+		}
+
+		GameInstance->Shutdown();
+		GameInstance->RemoveFromRoot();
+		GameInstance = nullptr;
+		FlowSubsystem = nullptr;
+
+		// world created by InitializeStandalone isn't destroyed together with its game instance
+		if (World)
+		{
+			GEngine->DestroyWorldContext(World);
+			World->DestroyWorld(false);
+			World = nullptr;
+		}
+
+		for (UFlowAsset* CreatedTemplate : CreatedTemplates)
+		{
+			CreatedTemplate->RemoveFromRoot();
+		}
+		CreatedTemplates.Empty();
+		Template = nullptr;
+	});
+
+	Describe("Single graph", [this]()
+	{
+		BeforeEach([this]()
+		{
+			Template = CreateTemplate(DefaultHopCount);
+		});
+
+		It("Should create a single root flow instance per owner", [this]()
+		{
+			if (!TestNotNull(TEXT("FlowSubsystem"), FlowSubsystem) || !TestNotNull(TEXT("Owner"), Owner))
+			{
+				return;
+			}
+
+			UFlowAsset* Instance = FlowSubsystem->CreateRootFlow(Owner, Template, false);
+			TestNotNull(TEXT("Instance"), Instance);
+
+			AddExpectedMessage(TEXT("Attempted to start Root Flow for the same Owner again"), ELogVerbosity::Warning);
+			TestNull(TEXT("Second instance for the same owner"), FlowSubsystem->CreateRootFlow(Owner, Template, false));
+			TestEqual(TEXT("Root instances of owner"), FlowSubsystem->GetRootInstancesByOwner(Owner).Num(), 1);
+			TestEqual(TEXT("Nodes of instance"), Instance ? Instance->GetNodes().Num() : 0, Template->GetNodes().Num());
+
+			FlowSubsystem->FinishRootFlow(Owner, Template, EFlowFinishPolicy::Abort);
+			TestEqual(TEXT("Root instances of owner after finish"), FlowSubsystem->GetRootInstancesByOwner(Owner).Num(), 0);
+		});
+
+		It("Should activate every node on the execution path once", [this]()
+		{
+			if (!TestNotNull(TEXT("FlowSubsystem"), FlowSubsystem) || !TestNotNull(TEXT("Owner"), Owner))
+			{
+				return;
+			}
+
+			FlowSubsystem->StartRootFlow(Owner, Template, false);
+			const UFlowAsset* Instance = FlowSubsystem->GetRootFlow(Owner);
+			if (!TestNotNull(TEXT("Instance"), Instance))
+			{
+				return;
+			}
+
+			// Start, every Reroute and Counter
+			TestEqual(TEXT("Recorded nodes"), Instance->GetRecordedNodes().Num(), DefaultHopCount + 2);
+
+			// Counter waits for the second Increment
+			TestEqual(TEXT("Active nodes"), Instance->GetActiveNodes().Num(), 1);
+
+			const UFlowNode* CounterNode = Instance->GetNode(CounterGuid);
+			TestTrue(TEXT("Counter is active"), CounterNode && CounterNode->GetActivationState() == EFlowNodeState::Active);
+			TestEqual(TEXT("Counter sum"), GetCounterSum(CounterNode), 1);
+
+			for (const TPair<FGuid, UFlowNode*>& Node : Instance->GetNodes())
+			{
+				if (Node.Value->IsA<UFlowNode_Reroute>())
+				{
+					TestTrue(TEXT("Reroute is completed"), Node.Value->GetActivationState() == EFlowNodeState::Completed);
+				}
+			}
+
+			const UFlowNode* LogNode = Instance->GetNode(LogGuid);
+			TestTrue(TEXT("Log isn't connected to execution"), LogNode && LogNode->GetActivationState() == EFlowNodeState::NeverActivated);
+		});
+
+		It("Should resolve data pin through the connected node", [this]()
+		{
+			if (!TestNotNull(TEXT("FlowSubsystem"), FlowSubsystem) || !TestNotNull(TEXT("Owner"), Owner))
+			{
+				return;
+			}
+
+			FlowSubsystem->StartRootFlow(Owner, Template, false);
+			const UFlowAsset* Instance = FlowSubsystem->GetRootFlow(Owner);
+			const UFlowNode* LogNode = Instance ? Instance->GetNode(LogGuid) : nullptr;
+			if (!TestNotNull(TEXT("Log node"), LogNode))
+			{
+				return;
+			}
+
+			const FFlowDataPinResult_String Result = LogNode->TryResolveDataPinAsString(TEXT("Message"));
+			TestTrue(TEXT("Resolve succeeded"), Result.Result == EFlowDataPinResolveResult::Success);
+			TestEqual(TEXT("Resolved value"), Result.Value, FString(FormattedValue));
+
+			// cached format is reused, value has to stay the same
+			TestEqual(TEXT("Resolved value on second call"), LogNode->TryResolveDataPinAsString(TEXT("Message")).Value, FString(FormattedValue));
+		});
+
+		It("Should restore active nodes from SaveGame", [this]()
+		{
+			if (!TestNotNull(TEXT("FlowSubsystem"), FlowSubsystem) || !TestNotNull(TEXT("Owner"), Owner))
+			{
+				return;
+			}
+
+			FlowSubsystem->StartRootFlow(Owner, Template, false);
+			const UFlowAsset* Instance = FlowSubsystem->GetRootFlow(Owner);
+			if (!TestNotNull(TEXT("Instance"), Instance))
+			{
+				return;
+			}
+			const FString SavedInstanceName = Instance->GetName();
+
+			UFlowSaveGame* SaveGame = NewObject<UFlowSaveGame>(GetTransientPackage());
+			FlowSubsystem->OnGameSaved(SaveGame);
+
+			// only the active Counter is written
+			if (!TestEqual(TEXT("Saved instances"), SaveGame->FlowInstances.Num(), 1))
+			{
+				return;
+			}
+			TestEqual(TEXT("Saved nodes"), SaveGame->FlowInstances[0].NodeRecords.Num(), 1);
+
+			FlowSubsystem->FinishRootFlow(Owner, Template, EFlowFinishPolicy::Abort);
+			TestNull(TEXT("Instance after finish"), FlowSubsystem->GetRootFlow(Owner));
+
+			FlowSubsystem->OnGameLoaded(SaveGame);
+			FlowSubsystem->LoadRootFlow(Owner, Template, SavedInstanceName, false);
+
+			const UFlowAsset* LoadedInstance = FlowSubsystem->GetRootFlow(Owner);
+			if (!TestNotNull(TEXT("Loaded instance"), LoadedInstance))
+			{
+				return;
+			}
+
+			TestEqual(TEXT("Active nodes after load"), LoadedInstance->GetActiveNodes().Num(), 1);
+
+			const UFlowNode* CounterNode = LoadedInstance->GetNode(CounterGuid);
+			TestTrue(TEXT("Counter is active after load"), CounterNode && CounterNode->GetActivationState() == EFlowNodeState::Active);
+			TestEqual(TEXT("Counter sum after load"), GetCounterSum(CounterNode), 1);
+
+			// no pins were triggered by loading
+			TestEqual(TEXT("Triggered inputs after load"), GetTriggeredInputCount(LoadedInstance), 0);
+		});
+	});
+
+	Describe("Scaling", [this]()
+	{
+		It("Should trigger one input pin and visit one node per hop at every graph size", [this]()
+		{
+			if (!TestNotNull(TEXT("FlowSubsystem"), FlowSubsystem) || !TestNotNull(TEXT("Owner"), Owner))
+			{
+				return;
+			}
+
+			for (const int32 HopCount : GraphSizes)
+			{
+				UFlowAsset* SizedTemplate = CreateTemplate(HopCount);
+				FlowSubsystem->StartRootFlow(Owner, SizedTemplate, false);
+
+				const UFlowAsset* Instance = FlowSubsystem->GetRootFlow(Owner);
+				if (!TestNotNull(FString::Printf(TEXT("Instance of %d hops"), HopCount), Instance))
+				{
+					return;
+				}
+
+				// every Reroute and Counter, Start node is entered through its output
+				TestEqual(FString::Printf(TEXT("Triggered inputs beyond one per hop, %d hops"), HopCount), GetTriggeredInputCount(Instance) - HopCount, 1);
+
+				// Start, every Reroute and Counter
+				TestEqual(FString::Printf(TEXT("Visited nodes beyond one per hop, %d hops"), HopCount), Instance->GetRecordedNodes().Num() - HopCount, 2);
+				TestEqual(FString::Printf(TEXT("Active nodes, %d hops"), HopCount), Instance->GetActiveNodes().Num(), 1);
+
+				FlowSubsystem->FinishRootFlow(Owner, SizedTemplate, EFlowFinishPolicy::Abort);
+			}
+		});
+
+		It("Should save and restore only active nodes at every graph size", [this]()
+		{
+			if (!TestNotNull(TEXT("FlowSubsystem"), FlowSubsystem) || !TestNotNull(TEXT("Owner"), Owner))
+			{
+				return;
+			}
+
+			for (const int32 HopCount : GraphSizes)
+			{
+				UFlowAsset* SizedTemplate = CreateTemplate(HopCount);
+				FlowSubsystem->StartRootFlow(Owner, SizedTemplate, false);
+
+				const UFlowAsset* Instance = FlowSubsystem->GetRootFlow(Owner);
+				if (!TestNotNull(FString::Printf(TEXT("Instance of %d hops"), HopCount), Instance))
+				{
+					return;
+				}
+				const FString SavedInstanceName = Instance->GetName();
+
+				UFlowSaveGame* SaveGame = NewObject<UFlowSaveGame>(GetTransientPackage());
+				FlowSubsystem->OnGameSaved(SaveGame);
+
+				// completed Reroutes aren't written, so the record doesn't grow with the graph
+				if (!TestEqual(FString::Printf(TEXT("Saved instances, %d hops"), HopCount), SaveGame->FlowInstances.Num(), 1))
+				{
+					return;
+				}
+				TestEqual(FString::Printf(TEXT("Saved nodes, %d hops"), HopCount), SaveGame->FlowInstances[0].NodeRecords.Num(), 1);
+
+				FlowSubsystem->FinishRootFlow(Owner, SizedTemplate, EFlowFinishPolicy::Abort);
+				FlowSubsystem->OnGameLoaded(SaveGame);
+				FlowSubsystem->LoadRootFlow(Owner, SizedTemplate, SavedInstanceName, false);
+
+				const UFlowAsset* LoadedInstance = FlowSubsystem->GetRootFlow(Owner);
+				if (!TestNotNull(FString::Printf(TEXT("Loaded instance of %d hops"), HopCount), LoadedInstance))
+				{
+					return;
+				}
+
+				TestEqual(FString::Printf(TEXT("Active nodes after load, %d hops"), HopCount), LoadedInstance->GetActiveNodes().Num(), 1);
+				TestEqual(FString::Printf(TEXT("Triggered inputs after load, %d hops"), HopCount), GetTriggeredInputCount(LoadedInstance), 0);
+
+				FlowSubsystem->FinishRootFlow(Owner, SizedTemplate, EFlowFinishPolicy::Abort);
+			}
+		});
+
+		It("Should return only matching components at every registry size", [this]()
+		{
+			if (!TestNotNull(TEXT("FlowSubsystem"), FlowSubsystem) || !TestNotNull(TEXT("World"), World))
+			{
+				return;
+			}
+
+			TSet<UFlowComponent*> MatchingComponents;
+			for (int32 Index = 0; Index < MatchingComponentCount; Index++)
+			{
+				MatchingComponents.Add(SpawnFlowComponent(TAG_FlowRuntimeSpec_Matching));
+			}
+
+			int32 OtherComponentCount = 0;
+			for (const int32 RegistrySize : GraphSizes)
+			{
+				// registry grows with components of another tag, matching components stay the same
+				for (; OtherComponentCount < RegistrySize; OtherComponentCount++)
+				{
+					SpawnFlowComponent(TAG_FlowRuntimeSpec_Other);
+				}
+
+				const TSet<TWeakObjectPtr<UFlowComponent>> FoundComponents = FlowSubsystem->GetComponents<UFlowComponent>(TAG_FlowRuntimeSpec_Matching, true, World);
+				TestEqual(FString::Printf(TEXT("Components found by tag, %d other components"), RegistrySize), FoundComponents.Num(), MatchingComponentCount);
+
+				for (const TWeakObjectPtr<UFlowComponent>& FoundComponent : FoundComponents)
+				{
+					TestTrue(FString::Printf(TEXT("Found component is matching, %d other components"), RegistrySize), MatchingComponents.Contains(FoundComponent.Get()));
+				}
+
+				const TSet<TWeakObjectPtr<AActor>> FoundActors = FlowSubsystem->GetActors<AActor>(TAG_FlowRuntimeSpec_Matching, true, World);
+				TestEqual(FString::Printf(TEXT("Actors found by tag, %d other components"), RegistrySize), FoundActors.Num(), MatchingComponentCount);
+
+				const TSet<UFlowComponent*> FoundByClass = FlowSubsystem->GetFlowComponentsByTag(TAG_FlowRuntimeSpec_Matching, UFlowComponent::StaticClass());
+				TestEqual(FString::Printf(TEXT("Components found by tag and class, %d other components"), RegistrySize), FoundByClass.Num(), MatchingComponentCount);
+			}
+		});
+	});
+}
+
+#endif
@@ -0,0 +1,82 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "FlowBenchmarkCommandlet.generated.h"
+
+class AActor;
+class UFlowAsset;
+class UFlowSubsystem;
+class UWorld;
+
+// Single measured row of the benchmark report
+struct FLOWEDITOR_API FFlowBenchmarkResult
+{
+	FString Asset;
+	FString Metric;
+
+	// Number of nodes in the template, used to compare results across graph sizes
+	int32 NodeCount = 0;
+
+	// Number of measured operations, i.e. instances multiplied by iterations
+	int32 Samples = 0;
+
+	double TotalSeconds = 0.0;
+	double MinSeconds = TNumericLimits<double>::Max();
+	double MaxSeconds = 0.0;
+
+	FFlowBenchmarkResult(const FString& InAsset, const FString& InMetric, const int32 InNodeCount)
+		: Asset(InAsset)
+		, Metric(InMetric)
+		, NodeCount(InNodeCount)
+	{
+	}
+
+	void AddSample(const double Seconds, const int32 Operations = 1);
+	double GetAverageMicroseconds() const;
+	double GetMinMicroseconds() const { return Samples > 0 ? MinSeconds * 1000000.0 : 0.0; }
+	double GetMaxMicroseconds() const { return MaxSeconds * 1000000.0; }
+};
+
+/**
+ * Headless benchmark of the Flow runtime, no rendering required.
+ * Measures instantiation, starting root flows, pin hops, data pin resolution, SaveInstance/LoadInstance and registry queries.
+ *
+ * Usage:
+ * UnrealEditor-Cmd.exe <Project> -run=FlowBenchmark -Assets=/Game/Flows/FA_Quest+/Game/Flows/FA_Dialogue -Synthetic=16+128+1024
+ *		-Instances=100 -Iterations=10 -Components=100+10000 -Tag=Flow.Benchmark -Output=Saved/FlowBenchmark.csv -nullrhi
+ *
+ * -Assets		Flow Asset templates to benchmark, separated by '+'
+ * -Synthetic	sizes of generated linear graphs (Start followed by a chain of Reroute nodes), separated by '+'
+ * -Instances	number of root flow instances created per iteration
+ * -Iterations	number of measured iterations per template
+ * -Components	numbers of Flow Components registered for the registry queries, separated by '+'
+ * -Tag			identity tag assigned to registered components, registry queries are skipped if the tag isn't valid
+ * -Output		report path, the extension selects the format: .csv or .json
+ *
+ * Reports timings only, correctness and operation counts of the same runtime paths are covered by the Flow.Runtime automation spec.
+ */
+UCLASS()
+class FLOWEDITOR_API UFlowBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UFlowBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+protected:
+	virtual void BenchmarkTemplate(UFlowSubsystem* FlowSubsystem, UFlowAsset* Template, const TArray<AActor*>& Owners, const int32 Iterations, const int32 HopCount);
+	virtual void BenchmarkRegistry(UFlowSubsystem* FlowSubsystem, UWorld* World, const int32 ComponentCount, const FString& TagName, const int32 Iterations);
+
+	static UFlowAsset* CreateSyntheticAsset(const int32 NodeCount);
+	static int32 ResolveAllDataPins(const UFlowAsset* FlowInstance);
+
+	bool WriteReport(const FString& OutputPath) const;
+	FString ToCSV() const;
+	FString ToJSON() const;
+
+	TArray<FFlowBenchmarkResult> Results;
+};
@@ -0,0 +1,26 @@
+﻿// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+using UnrealBuildTool;
+
+// Reads FlowChannel trace events, doesn't depend on the Flow runtime so it can be loaded by the standalone Unreal Insights
+public class FlowInsights : ModuleRules
+{
+	public FlowInsights(ReadOnlyTargetRules target) : base(target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(new[]
+		{
+			"Core"
+		});
+
+		PrivateDependencyModuleNames.AddRange(new[]
+		{
+			"Slate",
+			"SlateCore",
+			"TraceAnalysis",
+			"TraceInsights",
+			"TraceServices"
+		});
+	}
+}
@@ -0,0 +1,103 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "Analysis/FlowTraceAnalyzer.h"
+#include "Analysis/FlowTraceProvider.h"
+
+#include "TraceServices/Model/AnalysisSession.h"
+
+FFlowTraceAnalyzer::FFlowTraceAnalyzer(TraceServices::IAnalysisSession& InSession, FFlowTraceProvider& InProvider)
+	: Session(InSession)
+	, Provider(InProvider)
+{
+}
+
+void FFlowTraceAnalyzer::OnAnalysisBegin(const FOnAnalysisContext& Context)
+{
+	FInterfaceBuilder& Builder = Context.InterfaceBuilder;
+
+	Builder.RouteEvent(RouteId_InstanceCreated, "Flow", "InstanceCreated");
+	Builder.RouteEvent(RouteId_InstanceDestroyed, "Flow", "InstanceDestroyed");
+	Builder.RouteEvent(RouteId_NodeActivated, "Flow", "NodeActivated");
+	Builder.RouteEvent(RouteId_NodeFinished, "Flow", "NodeFinished");
+	Builder.RouteEvent(RouteId_PinTriggered, "Flow", "PinTriggered");
+	Builder.RouteEvent(RouteId_DataPinResolved, "Flow", "DataPinResolved");
+}
+
+bool FFlowTraceAnalyzer::OnEvent(const uint16 RouteId, EStyle Style, const FOnEventContext& Context)
+{
+	TraceServices::FAnalysisSessionEditScope _(Session);
+
+	const FEventData& EventData = Context.EventData;
+	const uint32 InstanceId = EventData.GetValue<uint32>("InstanceId");
+
+	switch (RouteId)
+	{
+		case RouteId_InstanceCreated:
+		{
+			const double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+
+			FString TemplatePath;
+			FString InstanceName;
+			EventData.GetString("TemplatePath", TemplatePath);
+			EventData.GetString("InstanceName", InstanceName);
+
+			Provider.AppendInstanceCreated(InstanceId, Time, TemplatePath, InstanceName);
+			Session.UpdateDurationSeconds(Time);
+			break;
+		}
+		case RouteId_InstanceDestroyed:
+		{
+			const double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+
+			Provider.AppendInstanceDestroyed(InstanceId, Time);
+			Session.UpdateDurationSeconds(Time);
+			break;
+		}
+		case RouteId_NodeActivated:
+		{
+			const double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+
+			FString NodeClass;
+			EventData.GetString("NodeClass", NodeClass);
+
+			Provider.AppendNodeActivated(InstanceId, EventData.GetValue<uint32>("NodeId"), Time, NodeClass);
+			Session.UpdateDurationSeconds(Time);
+			break;
+		}
+		case RouteId_NodeFinished:
+		{
+			const double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+
+			Provider.AppendNodeFinished(InstanceId, EventData.GetValue<uint32>("NodeId"), Time, EventData.GetValue<uint8>("State"));
+			Session.UpdateDurationSeconds(Time);
+			break;
+		}
+		case RouteId_PinTriggered:
+		{
+			const double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+
+			FString PinName;
+			EventData.GetString("PinName", PinName);
+
+			Provider.AppendPinTriggered(InstanceId, EventData.GetValue<uint32>("NodeId"), Time, PinName, EventData.GetValue<bool>("bInput"));
+			Session.UpdateDurationSeconds(Time);
+			break;
+		}
+		case RouteId_DataPinResolved:
+		{
+			const double StartTime = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("StartCycle"));
+			const double EndTime = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("EndCycle"));
+
+			FString PinName;
+			EventData.GetString("PinName", PinName);
+
+			Provider.AppendDataPinResolved(InstanceId, EventData.GetValue<uint32>("NodeId"), StartTime, EndTime, PinName, EventData.GetValue<uint8>("Result"));
+			Session.UpdateDurationSeconds(EndTime);
+			break;
+		}
+		default:
+			break;
+	}
+
+	return true;
+}
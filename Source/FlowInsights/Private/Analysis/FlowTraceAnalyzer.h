@@ -0,0 +1,38 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "Trace/Analyzer.h"
+
+class FFlowTraceProvider;
+
+namespace TraceServices
+{
+	class IAnalysisSession;
+}
+
+/**
+ * Reads events of the "Flow" logger, emitted by FFlowTrace, into FFlowTraceProvider.
+ */
+class FFlowTraceAnalyzer : public UE::Trace::IAnalyzer
+{
+public:
+	FFlowTraceAnalyzer(TraceServices::IAnalysisSession& InSession, FFlowTraceProvider& InProvider);
+
+	virtual void OnAnalysisBegin(const FOnAnalysisContext& Context) override;
+	virtual bool OnEvent(uint16 RouteId, EStyle Style, const FOnEventContext& Context) override;
+
+private:
+	enum : uint16
+	{
+		RouteId_InstanceCreated,
+		RouteId_InstanceDestroyed,
+		RouteId_NodeActivated,
+		RouteId_NodeFinished,
+		RouteId_PinTriggered,
+		RouteId_DataPinResolved,
+	};
+
+	TraceServices::IAnalysisSession& Session;
+	FFlowTraceProvider& Provider;
+};
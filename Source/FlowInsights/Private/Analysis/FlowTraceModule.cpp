@@ -0,0 +1,27 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "Analysis/FlowTraceModule.h"
+#include "Analysis/FlowTraceAnalyzer.h"
+#include "Analysis/FlowTraceProvider.h"
+
+#include "TraceServices/Model/AnalysisSession.h"
+
+const FName FFlowTraceModule::ModuleName(TEXT("FlowTrace"));
+
+void FFlowTraceModule::GetModuleInfo(TraceServices::FModuleInfo& OutModuleInfo)
+{
+	OutModuleInfo.Name = ModuleName;
+	OutModuleInfo.DisplayName = TEXT("Flow");
+}
+
+void FFlowTraceModule::OnAnalysisBegin(TraceServices::IAnalysisSession& InSession)
+{
+	const TSharedPtr<FFlowTraceProvider> Provider = MakeShared<FFlowTraceProvider>(InSession);
+	InSession.AddProvider(FFlowTraceProvider::ProviderName, Provider);
+	InSession.AddAnalyzer(new FFlowTraceAnalyzer(InSession, *Provider));
+}
+
+void FFlowTraceModule::GetLoggers(TArray<const TCHAR*>& OutLoggers)
+{
+	OutLoggers.Add(TEXT("Flow"));
+}
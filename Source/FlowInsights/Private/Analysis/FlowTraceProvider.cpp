@@ -0,0 +1,170 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "Analysis/FlowTraceProvider.h"
+
+#include "Misc/Paths.h"
+
+const FName FFlowTraceProvider::ProviderName(TEXT("FlowTraceProvider"));
+
+namespace FlowTraceProvider
+{
+	// Mirrors EFlowNodeState, this module doesn't depend on the Flow runtime
+	constexpr uint8 NodeStateAborted = 3;
+
+	// Mirrors EFlowDataPinResolveResult::Success
+	constexpr uint8 DataPinResolveSuccess = 0;
+}
+
+FFlowTraceProvider::FFlowTraceProvider(TraceServices::IAnalysisSession& InSession)
+	: Session(InSession)
+{
+}
+
+void FFlowTraceProvider::AppendInstanceCreated(const uint32 InstanceId, const double Time, const FString& TemplatePath, const FString& InstanceName)
+{
+	Session.WriteAccessCheck();
+
+	// ID reused without InstanceDestroyed received, i.e. the trace started after the previous instance was created
+	if (const int32* PreviousIndex = LiveInstances.Find(InstanceId))
+	{
+		FFlowTraceInstance& PreviousInstance = Instances[*PreviousIndex];
+		PreviousInstance.EndTime = Time;
+		PreviousInstance.ChangeNumber++;
+	}
+
+	FString TemplateName;
+	int32 SeparatorIndex;
+	if (TemplatePath.FindLastChar(TEXT('.'), SeparatorIndex))
+	{
+		TemplateName = TemplatePath.RightChop(SeparatorIndex + 1);
+	}
+	else
+	{
+		TemplateName = FPaths::GetBaseFilename(TemplatePath);
+	}
+
+	FFlowTraceInstance& Instance = Instances.AddDefaulted_GetRef();
+	Instance.InstanceId = InstanceId;
+	Instance.TemplatePath = Session.StoreString(*TemplatePath);
+	Instance.TemplateName = Session.StoreString(*TemplateName);
+	Instance.InstanceName = Session.StoreString(*InstanceName);
+	Instance.StartTime = Time;
+
+	LiveInstances.Add(InstanceId, Instances.Num() - 1);
+}
+
+void FFlowTraceProvider::AppendInstanceDestroyed(const uint32 InstanceId, const double Time)
+{
+	Session.WriteAccessCheck();
+
+	int32 Index;
+	if (LiveInstances.RemoveAndCopyValue(InstanceId, Index))
+	{
+		FFlowTraceInstance& Instance = Instances[Index];
+		Instance.EndTime = Time;
+
+		// Instance finishes all its nodes before it's destroyed, don't leave unmatched activations behind
+		for (const TPair<uint32, int32>& ActiveNode : Instance.ActiveNodes)
+		{
+			Instance.Nodes[ActiveNode.Value].EndTime = Time;
+		}
+		Instance.ActiveNodes.Empty();
+		Instance.ChangeNumber++;
+	}
+}
+
+void FFlowTraceProvider::AppendNodeActivated(const uint32 InstanceId, const uint32 NodeId, const double Time, const FString& NodeClass)
+{
+	Session.WriteAccessCheck();
+
+	FFlowTraceInstance& Instance = FindOrAddInstance(InstanceId, Time);
+	if (Instance.ActiveNodes.Contains(NodeId))
+	{
+		return;
+	}
+
+	int32 Lane = Instance.LaneEndTimes.IndexOfByPredicate([Time](const double LaneEndTime)
+	{
+		return LaneEndTime <= Time;
+	});
+	if (Lane == INDEX_NONE)
+	{
+		Lane = Instance.LaneEndTimes.Add(0.0);
+		Instance.NumNodeLanes = Instance.LaneEndTimes.Num();
+	}
+	Instance.LaneEndTimes[Lane] = TNumericLimits<double>::Max();
+
+	FFlowTraceNodeEvent& Node = Instance.Nodes.AddDefaulted_GetRef();
+	Node.StartTime = Time;
+	Node.NodeId = NodeId;
+	Node.Name = Session.StoreString(*NodeClass);
+	Node.Lane = Lane;
+
+	Instance.ActiveNodes.Add(NodeId, Instance.Nodes.Num() - 1);
+	Instance.ChangeNumber++;
+}
+
+void FFlowTraceProvider::AppendNodeFinished(const uint32 InstanceId, const uint32 NodeId, const double Time, const uint8 State)
+{
+	Session.WriteAccessCheck();
+
+	FFlowTraceInstance& Instance = FindOrAddInstance(InstanceId, Time);
+
+	int32 NodeIndex;
+	if (Instance.ActiveNodes.RemoveAndCopyValue(NodeId, NodeIndex))
+	{
+		FFlowTraceNodeEvent& Node = Instance.Nodes[NodeIndex];
+		Node.EndTime = Time;
+		if (State == FlowTraceProvider::NodeStateAborted)
+		{
+			Node.Name = Session.StoreString(*FString::Printf(TEXT("%s (Aborted)"), Node.Name));
+		}
+
+		Instance.LaneEndTimes[Node.Lane] = Time;
+		Instance.ChangeNumber++;
+	}
+}
+
+void FFlowTraceProvider::AppendPinTriggered(const uint32 InstanceId, const uint32 NodeId, const double Time, const FString& PinName, const bool bInput)
+{
+	Session.WriteAccessCheck();
+
+	FFlowTraceInstance& Instance = FindOrAddInstance(InstanceId, Time);
+
+	FFlowTracePinEvent& PinTrigger = Instance.PinTriggers.AddDefaulted_GetRef();
+	PinTrigger.StartTime = Time;
+	PinTrigger.EndTime = Time;
+	PinTrigger.NodeId = NodeId;
+	PinTrigger.Name = Session.StoreString(*FString::Printf(TEXT("%s: %s"), bInput ? TEXT("In") : TEXT("Out"), *PinName));
+
+	Instance.ChangeNumber++;
+}
+
+void FFlowTraceProvider::AppendDataPinResolved(const uint32 InstanceId, const uint32 NodeId, const double StartTime, const double EndTime, const FString& PinName, const uint8 Result)
+{
+	Session.WriteAccessCheck();
+
+	FFlowTraceInstance& Instance = FindOrAddInstance(InstanceId, StartTime);
+
+	FFlowTracePinEvent& DataPinResolve = Instance.DataPinResolves.AddDefaulted_GetRef();
+	DataPinResolve.StartTime = StartTime;
+	DataPinResolve.EndTime = EndTime;
+	DataPinResolve.NodeId = NodeId;
+	DataPinResolve.Name = Result == FlowTraceProvider::DataPinResolveSuccess
+		? Session.StoreString(*PinName)
+		: Session.StoreString(*FString::Printf(TEXT("%s (Failed)"), *PinName));
+
+	Instance.ChangeNumber++;
+}
+
+FFlowTraceInstance& FFlowTraceProvider::FindOrAddInstance(const uint32 InstanceId, const double Time)
+{
+	if (const int32* Index = LiveInstances.Find(InstanceId))
+	{
+		return Instances[*Index];
+	}
+
+	// Instance created before the trace started, template isn't known
+	AppendInstanceCreated(InstanceId, Time, FString(), FString::Printf(TEXT("Instance %u"), InstanceId));
+	return Instances.Last();
+}
@@ -0,0 +1,95 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "Containers/Map.h"
+#include "Math/NumericLimits.h"
+#include "TraceServices/Model/AnalysisSession.h"
+
+// Node activation, from NodeActivated until NodeFinished
+struct FFlowTraceNodeEvent
+{
+	double StartTime = 0.0;
+	double EndTime = TNumericLimits<double>::Max();
+
+	uint32 NodeId = 0;
+	const TCHAR* Name = nullptr;
+
+	// Lane within the instance, nodes active at the same time don't share it
+	uint32 Lane = 0;
+};
+
+// Pin trigger (zero duration) or data pin resolution
+struct FFlowTracePinEvent
+{
+	double StartTime = 0.0;
+	double EndTime = 0.0;
+
+	uint32 NodeId = 0;
+	const TCHAR* Name = nullptr;
+};
+
+struct FFlowTraceInstance
+{
+	uint32 InstanceId = 0;
+
+	const TCHAR* TemplatePath = nullptr;
+	const TCHAR* TemplateName = nullptr;
+	const TCHAR* InstanceName = nullptr;
+
+	double StartTime = 0.0;
+	double EndTime = TNumericLimits<double>::Max();
+
+	TArray<FFlowTraceNodeEvent> Nodes;
+	TArray<FFlowTracePinEvent> PinTriggers;
+	TArray<FFlowTracePinEvent> DataPinResolves;
+
+	// Number of lanes required to draw overlapping node activations
+	uint32 NumNodeLanes = 0;
+
+	// Incremented with every appended event, lets the timing track know it has to rebuild
+	uint32 ChangeNumber = 0;
+
+	bool IsActive() const { return EndTime == TNumericLimits<double>::Max(); }
+
+private:
+	friend class FFlowTraceProvider;
+
+	// Indices in Nodes of activations that haven't finished yet, keyed by NodeId
+	TMap<uint32, int32> ActiveNodes;
+	TArray<double> LaneEndTimes;
+};
+
+/**
+ * Flow Asset instances and their node activations, read from the "Flow" trace logger.
+ * Writes happen under FAnalysisSessionEditScope, reads need FAnalysisSessionReadScope.
+ */
+class FFlowTraceProvider : public TraceServices::IProvider
+{
+public:
+	static const FName ProviderName;
+
+	explicit FFlowTraceProvider(TraceServices::IAnalysisSession& InSession);
+
+	void AppendInstanceCreated(const uint32 InstanceId, const double Time, const FString& TemplatePath, const FString& InstanceName);
+	void AppendInstanceDestroyed(const uint32 InstanceId, const double Time);
+
+	void AppendNodeActivated(const uint32 InstanceId, const uint32 NodeId, const double Time, const FString& NodeClass);
+	void AppendNodeFinished(const uint32 InstanceId, const uint32 NodeId, const double Time, const uint8 State);
+	void AppendPinTriggered(const uint32 InstanceId, const uint32 NodeId, const double Time, const FString& PinName, const bool bInput);
+	void AppendDataPinResolved(const uint32 InstanceId, const uint32 NodeId, const double StartTime, const double EndTime, const FString& PinName, const uint8 Result);
+
+	// Instances in order of creation, indices are stable
+	int32 GetNumInstances() const { return Instances.Num(); }
+	const FFlowTraceInstance& GetInstance(const int32 Index) const { return Instances[Index]; }
+
+private:
+	FFlowTraceInstance& FindOrAddInstance(const uint32 InstanceId, const double Time);
+
+	TraceServices::IAnalysisSession& Session;
+
+	TArray<FFlowTraceInstance> Instances;
+
+	// UObject unique IDs are recycled, so an ID maps to an instance only until InstanceDestroyed
+	TMap<uint32, int32> LiveInstances;
+};
@@ -0,0 +1,34 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "FlowInsightsModule.h"
+#include "Analysis/FlowTraceModule.h"
+#include "Timing/FlowTimingViewExtender.h"
+
+#include "Features/IModularFeatures.h"
+#include "Insights/ITimingViewExtender.h"
+#include "Modules/ModuleManager.h"
+#include "TraceServices/ModuleService.h"
+
+#define LOCTEXT_NAMESPACE "FlowInsightsModule"
+
+void FFlowInsightsModule::StartupModule()
+{
+	TraceModule = MakeShared<FFlowTraceModule>();
+	TimingViewExtender = MakeShared<FFlowTimingViewExtender>();
+
+	IModularFeatures::Get().RegisterModularFeature(TraceServices::ModuleFeatureName, TraceModule.Get());
+	IModularFeatures::Get().RegisterModularFeature(UE::Insights::Timing::TimingViewExtenderFeatureName, TimingViewExtender.Get());
+}
+
+void FFlowInsightsModule::ShutdownModule()
+{
+	IModularFeatures::Get().UnregisterModularFeature(UE::Insights::Timing::TimingViewExtenderFeatureName, TimingViewExtender.Get());
+	IModularFeatures::Get().UnregisterModularFeature(TraceServices::ModuleFeatureName, TraceModule.Get());
+
+	TimingViewExtender.Reset();
+	TraceModule.Reset();
+}
+
+#undef LOCTEXT_NAMESPACE
+
+IMPLEMENT_MODULE(FFlowInsightsModule, FlowInsights)
@@ -0,0 +1,89 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "Timing/FlowInstanceTimingTrack.h"
+#include "Analysis/FlowTraceProvider.h"
+
+#include "Insights/ViewModels/ITimingViewDrawHelper.h"
+#include "Insights/ViewModels/TimingTrackViewport.h"
+
+INSIGHTS_IMPLEMENT_RTTI(FFlowInstanceTimingTrack)
+
+namespace FlowInstanceTimingTrack
+{
+	constexpr uint32 InstanceColor = 0xFF3C6E8C;
+	constexpr uint32 PinTriggerColor = 0xFF8C8C3C;
+	constexpr uint32 DataPinResolveColor = 0xFF3C8C5A;
+}
+
+FFlowInstanceTimingTrack::FFlowInstanceTimingTrack(const TraceServices::IAnalysisSession& InAnalysisSession, const int32 InInstanceIndex, const FString& InName)
+	: FTimingEventsTrack(InName)
+	, AnalysisSession(InAnalysisSession)
+	, InstanceIndex(InInstanceIndex)
+{
+}
+
+void FFlowInstanceTimingTrack::BuildDrawState(ITimingEventsTrackDrawStateBuilder& Builder, const ITimingTrackUpdateContext& Context)
+{
+	TraceServices::FAnalysisSessionReadScope SessionReadScope(AnalysisSession);
+
+	const FFlowTraceProvider* Provider = AnalysisSession.ReadProvider<FFlowTraceProvider>(FFlowTraceProvider::ProviderName);
+	if (Provider == nullptr || InstanceIndex >= Provider->GetNumInstances())
+	{
+		return;
+	}
+
+	const FFlowTraceInstance& Instance = Provider->GetInstance(InstanceIndex);
+	DrawnChangeNumber = Instance.ChangeNumber;
+
+	const FTimingTrackViewport& Viewport = Context.GetViewport();
+	const double ViewStartTime = Viewport.GetStartTime();
+	const double ViewEndTime = Viewport.GetEndTime();
+
+	// Events still in progress are drawn until the end of the session
+	const double SessionEndTime = AnalysisSession.GetDurationSeconds();
+	auto AddEvent = [&](const double StartTime, const double EndTime, const uint32 Depth, const TCHAR* Name, const uint32 Color)
+	{
+		const double ClampedEndTime = FMath::Min(EndTime, SessionEndTime);
+		if (ClampedEndTime >= ViewStartTime && StartTime <= ViewEndTime)
+		{
+			Builder.AddEvent(StartTime, ClampedEndTime, Depth, Name, 0, Color);
+		}
+	};
+
+	AddEvent(Instance.StartTime, Instance.EndTime, 0, Instance.InstanceName, FlowInstanceTimingTrack::InstanceColor);
+
+	for (const FFlowTraceNodeEvent& Node : Instance.Nodes)
+	{
+		// Color 0 lets Insights pick a color from the event name, so every node class keeps its color
+		AddEvent(Node.StartTime, Node.EndTime, 1 + Node.Lane, Node.Name, 0);
+	}
+
+	const uint32 PinTriggerDepth = 1 + Instance.NumNodeLanes;
+	for (const FFlowTracePinEvent& PinTrigger : Instance.PinTriggers)
+	{
+		AddEvent(PinTrigger.StartTime, PinTrigger.EndTime, PinTriggerDepth, PinTrigger.Name, FlowInstanceTimingTrack::PinTriggerColor);
+	}
+
+	for (const FFlowTracePinEvent& DataPinResolve : Instance.DataPinResolves)
+	{
+		AddEvent(DataPinResolve.StartTime, DataPinResolve.EndTime, PinTriggerDepth + 1, DataPinResolve.Name, FlowInstanceTimingTrack::DataPinResolveColor);
+	}
+}
+
+void FFlowInstanceTimingTrack::Update()
+{
+	TraceServices::FAnalysisSessionReadScope SessionReadScope(AnalysisSession);
+
+	const FFlowTraceProvider* Provider = AnalysisSession.ReadProvider<FFlowTraceProvider>(FFlowTraceProvider::ProviderName);
+	if (Provider == nullptr || InstanceIndex >= Provider->GetNumInstances())
+	{
+		return;
+	}
+
+	// Active instances grow with the session, even without new events
+	const FFlowTraceInstance& Instance = Provider->GetInstance(InstanceIndex);
+	if (Instance.ChangeNumber != DrawnChangeNumber || (Instance.IsActive() && !AnalysisSession.IsAnalysisComplete()))
+	{
+		SetDirtyFlag();
+	}
+}
@@ -0,0 +1,35 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "Insights/ViewModels/TimingEventsTrack.h"
+
+namespace TraceServices
+{
+	class IAnalysisSession;
+}
+
+/**
+ * Timing track of a single Flow Asset instance.
+ * Depth 0 is the instance lifetime, followed by lanes of node activations, pin triggers and data pin resolutions.
+ */
+class FFlowInstanceTimingTrack : public FTimingEventsTrack
+{
+	INSIGHTS_DECLARE_RTTI(FFlowInstanceTimingTrack, FTimingEventsTrack)
+
+public:
+	FFlowInstanceTimingTrack(const TraceServices::IAnalysisSession& InAnalysisSession, const int32 InInstanceIndex, const FString& InName);
+
+	virtual void BuildDrawState(ITimingEventsTrackDrawStateBuilder& Builder, const ITimingTrackUpdateContext& Context) override;
+
+	// Marks the track dirty if the instance received events since the last draw state
+	void Update();
+
+	int32 GetInstanceIndex() const { return InstanceIndex; }
+
+private:
+	const TraceServices::IAnalysisSession& AnalysisSession;
+	int32 InstanceIndex;
+
+	uint32 DrawnChangeNumber = 0;
+};
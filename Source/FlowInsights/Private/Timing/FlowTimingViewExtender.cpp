@@ -0,0 +1,68 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#include "Timing/FlowTimingViewExtender.h"
+#include "Analysis/FlowTraceProvider.h"
+#include "Timing/FlowInstanceTimingTrack.h"
+
+#include "Insights/ITimingViewSession.h"
+#include "Insights/ViewModels/BaseTimingTrack.h"
+
+namespace FlowTimingViewExtender
+{
+	// Track order range reserved for instances of a single template asset
+	constexpr int32 AssetGroupSize = 1000;
+}
+
+void FFlowTimingViewExtender::OnBeginSession(UE::Insights::Timing::ITimingViewSession& InSession)
+{
+	PerSessionDataMap.Add(&InSession);
+}
+
+void FFlowTimingViewExtender::OnEndSession(UE::Insights::Timing::ITimingViewSession& InSession)
+{
+	PerSessionDataMap.Remove(&InSession);
+}
+
+void FFlowTimingViewExtender::Tick(UE::Insights::Timing::ITimingViewSession& InSession, const TraceServices::IAnalysisSession& InAnalysisSession)
+{
+	FPerSessionData* PerSessionData = PerSessionDataMap.Find(&InSession);
+	if (PerSessionData == nullptr)
+	{
+		return;
+	}
+
+	for (const TSharedPtr<FFlowInstanceTimingTrack>& Track : PerSessionData->Tracks)
+	{
+		Track->Update();
+	}
+
+	TraceServices::FAnalysisSessionReadScope SessionReadScope(InAnalysisSession);
+
+	const FFlowTraceProvider* Provider = InAnalysisSession.ReadProvider<FFlowTraceProvider>(FFlowTraceProvider::ProviderName);
+	if (Provider == nullptr || Provider->GetNumInstances() == PerSessionData->Tracks.Num())
+	{
+		return;
+	}
+
+	for (int32 InstanceIndex = PerSessionData->Tracks.Num(); InstanceIndex < Provider->GetNumInstances(); InstanceIndex++)
+	{
+		const FFlowTraceInstance& Instance = Provider->GetInstance(InstanceIndex);
+
+		TPair<int32, int32>* AssetGroup = PerSessionData->AssetGroups.Find(Instance.TemplatePath);
+		if (AssetGroup == nullptr)
+		{
+			AssetGroup = &PerSessionData->AssetGroups.Add(Instance.TemplatePath, TPair<int32, int32>(PerSessionData->AssetGroups.Num(), 0));
+		}
+
+		const TCHAR* TemplateName = *Instance.TemplateName ? Instance.TemplateName : TEXT("Unknown Flow Asset");
+		const TSharedPtr<FFlowInstanceTimingTrack> Track = MakeShared<FFlowInstanceTimingTrack>(InAnalysisSession, InstanceIndex, FString::Printf(TEXT("Flow: %s - %s"), TemplateName, Instance.InstanceName));
+
+		const int32 InstanceInGroup = FMath::Min(AssetGroup->Value++, FlowTimingViewExtender::AssetGroupSize - 1);
+		Track->SetOrder(FTimingTrackOrder::Misc + AssetGroup->Key * FlowTimingViewExtender::AssetGroupSize + InstanceInGroup);
+
+		PerSessionData->Tracks.Add(Track);
+		InSession.AddScrollableTrack(Track);
+	}
+
+	InSession.InvalidateScrollableTracksOrder();
+}
@@ -0,0 +1,30 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "Insights/ITimingViewExtender.h"
+
+class FFlowInstanceTimingTrack;
+
+/**
+ * Adds a timing track for every traced Flow Asset instance.
+ * Tracks are grouped by the template asset, in the order assets appeared in the trace.
+ */
+class FFlowTimingViewExtender : public UE::Insights::Timing::ITimingViewExtender
+{
+public:
+	virtual void OnBeginSession(UE::Insights::Timing::ITimingViewSession& InSession) override;
+	virtual void OnEndSession(UE::Insights::Timing::ITimingViewSession& InSession) override;
+	virtual void Tick(UE::Insights::Timing::ITimingViewSession& InSession, const TraceServices::IAnalysisSession& InAnalysisSession) override;
+
+private:
+	struct FPerSessionData
+	{
+		TArray<TSharedPtr<FFlowInstanceTimingTrack>> Tracks;
+
+		// Template path to the asset group index and number of instance tracks in the group
+		TMap<FString, TPair<int32, int32>> AssetGroups;
+	};
+
+	TMap<UE::Insights::Timing::ITimingViewSession*, FPerSessionData> PerSessionDataMap;
+};
@@ -0,0 +1,24 @@
+// Copyright https://github.com/MothCocoon/FlowGraph/graphs/contributors
+
+#pragma once
+
+#include "Modules/ModuleInterface.h"
+#include "Templates/SharedPointer.h"
+
+class FFlowTraceModule;
+class FFlowTimingViewExtender;
+
+/**
+ * Visualizes FlowChannel trace events in Unreal Insights.
+ * Registers the trace analyzer with TraceServices and adds a timing track per Flow Asset instance to the Timing view.
+ */
+class FLOWINSIGHTS_API FFlowInsightsModule : public IModuleInterface
+{
+public:
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
+
+private:
+	TSharedPtr<FFlowTraceModule> TraceModule;
+	TSharedPtr<FFlowTimingViewExtender> TimingViewExtender;
+};